@@ -0,0 +1,34 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include <cstddef>
+#include <vector>
+
+
+
+
+
+
+
+
+
+class AliasTable {
+public:
+
+
+    void build(const std::vector<float>& weights);
+
+
+
+    std::size_t sample(float column, float coin) const;
+
+    std::size_t size() const { return m_probability.size(); }
+    bool empty() const { return m_probability.empty(); }
+    void clear();
+
+private:
+    std::vector<float> m_probability;
+    std::vector<std::size_t> m_alias;
+};
+
+#endif
@@ -1,41 +1,73 @@
 #ifndef DIALOGUE_MANAGER_H
 #define DIALOGUE_MANAGER_H
 
+#include "FlagSet.h"
+#include "StringId.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
-#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 
-class NPC;
+class PlayerState;
 
 
-struct DialogueCondition {
-    std::function<bool()> check;
-    std::string description;
 
-    DialogueCondition() : check([]() { return true; }), description("") {}
-    explicit DialogueCondition(std::function<bool()> checkFunc, const std::string& desc = "")
-        : check(checkFunc), description(desc) {}
+
+enum class DialogueOpCode : std::uint8_t {
+    REQUIRE_MONEY,
+    REQUIRE_ITEM,
+    REQUIRE_FLAG,
+    REQUIRE_NOT_FLAG,
+    REQUIRE_RELATIONSHIP,
+    SPEND_MONEY,
+    ADD_MONEY,
+    REMOVE_ITEM,
+    MODIFY_RELATIONSHIP,
+    SET_FLAG
 };
 
+struct DialogueOp {
+    DialogueOpCode code;
+    StringId target;
+    float value;
+
+    static DialogueOp requireMoney(float amount) { return {DialogueOpCode::REQUIRE_MONEY, StringId(), amount}; }
+    static DialogueOp requireItem(StringId item, int count = 1) {
+        return {DialogueOpCode::REQUIRE_ITEM, item, static_cast<float>(count)};
+    }
+    static DialogueOp requireFlag(StringId flag) { return {DialogueOpCode::REQUIRE_FLAG, flag, 0.0f}; }
+    static DialogueOp requireNotFlag(StringId flag) { return {DialogueOpCode::REQUIRE_NOT_FLAG, flag, 0.0f}; }
+    static DialogueOp requireRelationship(StringId npcId, int minimum) {
+        return {DialogueOpCode::REQUIRE_RELATIONSHIP, npcId, static_cast<float>(minimum)};
+    }
+
+    static DialogueOp spendMoney(float amount) { return {DialogueOpCode::SPEND_MONEY, StringId(), amount}; }
+    static DialogueOp addMoney(float amount) { return {DialogueOpCode::ADD_MONEY, StringId(), amount}; }
+    static DialogueOp removeItem(StringId item, int count = 1) {
+        return {DialogueOpCode::REMOVE_ITEM, item, static_cast<float>(count)};
+    }
+    static DialogueOp modifyRelationship(StringId npcId, int delta) {
+        return {DialogueOpCode::MODIFY_RELATIONSHIP, npcId, static_cast<float>(delta)};
+    }
+    static DialogueOp setFlag(StringId flag) { return {DialogueOpCode::SET_FLAG, flag, 0.0f}; }
+};
 
-struct DialogueConsequence {
-    std::function<void()> execute;
-    std::string description;
 
-    DialogueConsequence() : execute([]() {}), description("") {}
-    explicit DialogueConsequence(std::function<void()> execFunc, const std::string& desc = "")
-        : execute(execFunc), description(desc) {}
-};
 
 
 struct DialogueChoice {
     std::string text;
+    StringId id;
     std::string nextNodeId;
-    DialogueCondition condition;
-    DialogueConsequence consequence;
+    std::vector<DialogueOp> conditions;
+    std::vector<DialogueOp> effects;
+
+
+
     bool requiresMoney;
     float moneyCost;
     bool requiresItem;
@@ -71,13 +103,56 @@ struct DialogueTree {
 
 
 
+
+
+struct CompiledDialogue {
+    static constexpr int END_NODE = -1;
+
+    struct Node {
+        std::string speakerName;
+        std::string text;
+        std::uint32_t firstChoice = 0;
+        std::uint32_t choiceCount = 0;
+        bool isPlayerSpeaking = false;
+        bool isEndNode = false;
+    };
+
+    struct Choice {
+        std::string text;
+        StringId id;
+        int nextNode = END_NODE;
+        std::uint32_t firstCondition = 0;
+        std::uint32_t conditionCount = 0;
+        std::uint32_t firstEffect = 0;
+        std::uint32_t effectCount = 0;
+    };
+
+    std::string id;
+    std::string title;
+    int startNode = 0;
+    std::vector<Node> nodes;
+    std::vector<Choice> choices;
+    std::vector<DialogueOp> ops;
+    std::vector<std::string> nodeIds;
+
+    const Choice* getChoice(const Node& node, int choiceIndex) const;
+    int findNode(const std::string& nodeId) const;
+};
+
+
+
+bool compileDialogue(const DialogueTree& tree, CompiledDialogue& compiled);
+
+
+
 class DialogueManager {
 public:
 
     static DialogueManager& getInstance();
 
 
-    void registerDialogue(const std::string& id, const DialogueTree& tree);
+    bool registerDialogue(const std::string& id, const DialogueTree& tree);
+    void registerDialogue(const std::string& id, std::shared_ptr<const CompiledDialogue> dialogue);
     void removeDialogue(const std::string& id);
     bool hasDialogue(const std::string& id) const;
 
@@ -87,22 +162,37 @@ public:
 
     void selectChoice(int choiceIndex);
     bool goToNode(const std::string& nodeId);
+    bool goToNode(int nodeIndex);
     void endDialogue();
 
 
     bool isActive() const { return m_active; }
-    const DialogueNode* getCurrentNode() const;
-    const DialogueTree* getCurrentTree() const;
+    const CompiledDialogue::Node* getCurrentNode() const;
+    const CompiledDialogue* getCurrentTree() const { return m_current.get(); }
     std::string getCurrentDialogueId() const { return m_currentDialogueId; }
+    const CompiledDialogue::Choice* getChoice(int choiceIndex) const;
 
 
     bool isChoiceAvailable(int choiceIndex) const;
     std::string getChoiceUnavailableReason(int choiceIndex) const;
 
 
-    void addToHistory(const std::string& dialogueId, const std::string& choiceId);
-    bool wasChoiceMade(const std::string& dialogueId, const std::string& choiceId) const;
+
+    void setPlayerState(PlayerState* playerState) { m_playerState = playerState; }
+
+
+    void setFlag(StringId flag);
+    bool hasFlag(StringId flag) const { return m_flagSet.has(flag); }
+    const std::vector<StringId>& getFlags() const { return m_flags; }
+    void clearFlags() { m_flags.clear(); m_flagSet.clear(); }
+
+
+
+
+    void addToHistory(StringId dialogueId, StringId choiceId);
+    bool wasChoiceMade(StringId dialogueId, StringId choiceId) const;
     void clearHistory();
+    const std::unordered_map<StringId, std::vector<StringId>>& getHistory() const { return m_history; }
 
 
     void clear();
@@ -115,13 +205,23 @@ private:
     DialogueManager(const DialogueManager&) = delete;
     DialogueManager& operator=(const DialogueManager&) = delete;
 
-    std::map<std::string, DialogueTree> m_dialogues;
+    const DialogueOp* findFailedCondition(const CompiledDialogue::Choice& choice) const;
+    bool checkCondition(const DialogueOp& op) const;
+    void applyEffect(const DialogueOp& op);
+
+    std::unordered_map<std::string, std::shared_ptr<const CompiledDialogue>> m_dialogues;
+    std::shared_ptr<const CompiledDialogue> m_current;
     std::string m_currentDialogueId;
-    std::string m_currentNodeId;
+    int m_currentNode;
     bool m_active;
 
+    PlayerState* m_playerState;
+    std::vector<StringId> m_flags;
+    FlagSet m_flagSet;
+
 
-    std::map<std::string, std::vector<std::string>> m_history;
+    std::unordered_map<StringId, std::vector<StringId>> m_history;
+    std::unordered_set<std::uint64_t> m_madeChoices;
 
     static DialogueManager* s_instance;
 };
@@ -1,25 +1,16 @@
 #ifndef EVENT_BUS_H
 #define EVENT_BUS_H
 
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <map>
-#include <vector>
-#include <string>
 #include <memory>
-#include <mutex>
-#include <any>
-
-
-
-
-
-
-
-
-
-
-
-
+#include <string>
+#include <utility>
+#include <vector>
 
 
 
@@ -40,7 +31,6 @@
 
 
 
-using EventCallback = std::function<void(const std::any&)>;
 
 
 struct ResourceChangeEvent {
@@ -81,48 +71,54 @@ struct QuestEvent {
     float progress;
 };
 
-struct GameEvent {
+struct GenericEvent {
     std::string eventId;
     std::string eventType;
     std::map<std::string, std::any> eventData;
 };
 
-class EventBus {
-public:
-
-
-
-    static EventBus& getInstance();
-
 
 
 
+namespace EventBusDetail {
+    std::size_t nextTypeIndex();
 
+    template<typename T>
+    std::size_t typeIndex() {
+        static const std::size_t index = nextTypeIndex();
+        return index;
+    }
+}
 
-
-    int subscribe(const std::string& eventType, EventCallback callback);
-
+class EventBus {
+public:
 
 
 
+    static EventBus& getInstance();
 
 
 
-    bool unsubscribe(const std::string& eventType, int listenerId);
 
 
 
+    template<typename T>
+    int subscribe(std::function<void(const T&)> callback);
 
 
+    template<typename T>
+    bool unsubscribe(int listenerId);
 
-    void publish(const std::string& eventType, const std::any& data);
 
 
+    template<typename T>
+    void publish(const T& event);
 
 
 
 
-    void queueEvent(const std::string& eventType, const std::any& data);
+    template<typename T>
+    void queueEvent(T event);
 
 
 
@@ -131,60 +127,214 @@ public:
     void processQueue();
 
 
-
-
-
-    void clearSubscribers(const std::string& eventType);
-
-
+    template<typename T>
+    void clearSubscribers();
 
 
     void clearAllSubscribers();
 
 
-
-
-    size_t getSubscriberCount(const std::string& eventType) const;
-
+    template<typename T>
+    std::size_t getSubscriberCount() const;
 
     EventBus(const EventBus&) = delete;
     EventBus& operator=(const EventBus&) = delete;
 
 private:
-    EventBus() : m_nextListenerId(1) {}
+    EventBus();
+    ~EventBus();
 
-    struct Listener {
-        int id;
-        EventCallback callback;
+    struct ChannelBase {
+        virtual ~ChannelBase() = default;
+        virtual void clear() = 0;
     };
 
-    struct QueuedEvent {
-        std::string eventType;
-        std::any data;
+    template<typename T>
+    struct Channel : ChannelBase {
+        struct Listener {
+            int id;
+            bool active;
+            std::function<void(const T&)> callback;
+        };
+
+        std::vector<Listener> listeners;
+        std::vector<Listener> pending;
+        int dispatchDepth = 0;
+        bool needsCompact = false;
+
+        void clear() override {
+            if (dispatchDepth > 0) {
+                for (auto& listener : listeners) {
+                    listener.active = false;
+                }
+                needsCompact = true;
+            } else {
+                listeners.clear();
+            }
+            pending.clear();
+        }
     };
 
 
-    std::map<std::string, std::vector<Listener>> m_listeners;
+    struct QueueNode {
+        std::atomic<QueueNode*> next{nullptr};
+        virtual ~QueueNode() = default;
+        virtual void dispatch(EventBus& bus) { (void)bus; }
+    };
 
+    template<typename T>
+    struct TypedQueueNode : QueueNode {
+        explicit TypedQueueNode(T&& value) : event(std::move(value)) {}
+        void dispatch(EventBus& bus) override { bus.publish<T>(event); }
+        T event;
+    };
+
+    template<typename T>
+    Channel<T>* findChannel() const;
+
+    template<typename T>
+    Channel<T>& getChannel();
 
-    std::vector<QueuedEvent> m_eventQueue;
+    void pushNode(QueueNode* node);
+    QueueNode* popNode();
 
 
-    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ChannelBase>> m_channels;
 
 
+    std::atomic<QueueNode*> m_queueHead;
+    QueueNode* m_queueTail;
+    QueueNode m_queueStub;
+    std::vector<QueueNode*> m_batch;
+
     int m_nextListenerId;
 };
 
 
-#define EVENT_RESOURCE_CHANGED "ResourceChanged"
-#define EVENT_INVENTORY_CHANGED "InventoryChanged"
-#define EVENT_NPC_CHANGED "NPCChanged"
-#define EVENT_SCENE_TRANSITION "SceneTransition"
-#define EVENT_QUEST_UPDATE "QuestUpdate"
-#define EVENT_GAME_EVENT "GameEvent"
-#define EVENT_UI_UPDATE "UIUpdate"
-#define EVENT_SAVE_GAME "SaveGame"
-#define EVENT_LOAD_GAME "LoadGame"
+
+template<typename T>
+EventBus::Channel<T>* EventBus::findChannel() const {
+    std::size_t index = EventBusDetail::typeIndex<T>();
+    if (index >= m_channels.size() || !m_channels[index]) {
+        return nullptr;
+    }
+    return static_cast<Channel<T>*>(m_channels[index].get());
+}
+
+template<typename T>
+EventBus::Channel<T>& EventBus::getChannel() {
+    std::size_t index = EventBusDetail::typeIndex<T>();
+    if (index >= m_channels.size()) {
+        m_channels.resize(index + 1);
+    }
+    if (!m_channels[index]) {
+        m_channels[index] = std::make_unique<Channel<T>>();
+    }
+    return *static_cast<Channel<T>*>(m_channels[index].get());
+}
+
+template<typename T>
+int EventBus::subscribe(std::function<void(const T&)> callback) {
+    Channel<T>& channel = getChannel<T>();
+    int listenerId = m_nextListenerId++;
+
+
+    if (channel.dispatchDepth > 0) {
+        channel.pending.push_back({listenerId, true, std::move(callback)});
+    } else {
+        channel.listeners.push_back({listenerId, true, std::move(callback)});
+    }
+    return listenerId;
+}
+
+template<typename T>
+bool EventBus::unsubscribe(int listenerId) {
+    Channel<T>* channel = findChannel<T>();
+    if (!channel) {
+        return false;
+    }
+
+    auto& listeners = channel->listeners;
+    for (auto it = listeners.begin(); it != listeners.end(); ++it) {
+        if (it->id == listenerId && it->active) {
+            if (channel->dispatchDepth > 0) {
+                it->active = false;
+                channel->needsCompact = true;
+            } else {
+                listeners.erase(it);
+            }
+            return true;
+        }
+    }
+
+    for (auto it = channel->pending.begin(); it != channel->pending.end(); ++it) {
+        if (it->id == listenerId) {
+            channel->pending.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void EventBus::publish(const T& event) {
+    Channel<T>* channel = findChannel<T>();
+    if (!channel) {
+        return;
+    }
+
+    channel->dispatchDepth++;
+    const std::size_t count = channel->listeners.size();
+    for (std::size_t i = 0; i < count; i++) {
+        if (channel->listeners[i].active) {
+            channel->listeners[i].callback(event);
+        }
+    }
+    channel->dispatchDepth--;
+
+    if (channel->dispatchDepth == 0) {
+        if (channel->needsCompact) {
+            auto& listeners = channel->listeners;
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                                [](const auto& listener) { return !listener.active; }),
+                            listeners.end());
+            channel->needsCompact = false;
+        }
+        if (!channel->pending.empty()) {
+            for (auto& listener : channel->pending) {
+                channel->listeners.push_back(std::move(listener));
+            }
+            channel->pending.clear();
+        }
+    }
+}
+
+template<typename T>
+void EventBus::queueEvent(T event) {
+    pushNode(new TypedQueueNode<T>(std::move(event)));
+}
+
+template<typename T>
+void EventBus::clearSubscribers() {
+    if (Channel<T>* channel = findChannel<T>()) {
+        channel->clear();
+    }
+}
+
+template<typename T>
+std::size_t EventBus::getSubscriberCount() const {
+    Channel<T>* channel = findChannel<T>();
+    if (!channel) {
+        return 0;
+    }
+
+    std::size_t count = channel->pending.size();
+    for (const auto& listener : channel->listeners) {
+        if (listener.active) {
+            count++;
+        }
+    }
+    return count;
+}
 
 #endif
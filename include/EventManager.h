@@ -1,9 +1,15 @@
 #ifndef EVENT_MANAGER_H
 #define EVENT_MANAGER_H
 
+#include "AliasTable.h"
+#include "Random.h"
+#include "StringId.h"
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <functional>
 #include <memory>
 
@@ -34,7 +40,7 @@ struct EventCondition {
     std::vector<std::string> requiredNPCsInParty;
     std::map<std::string, int> minRelationships;
     std::vector<std::string> requiredItems;
-    std::vector<std::string> blockedIfTriggered;
+    std::vector<StringId> blockedIfTriggered;
     int minPartySize = 0;
     int maxPartySize = 999;
 
@@ -87,7 +93,6 @@ struct GameEvent {
     std::string description;
     EventCondition condition;
     std::vector<EventChoice> choices;
-    bool triggered = false;
 
 
     EventType type = EventType::ROAD;
@@ -113,10 +118,10 @@ public:
     void addEvent(const GameEvent& event);
 
 
-    void removeEvent(const std::string& id);
+    void removeEvent(StringId id);
 
 
-    GameEvent* getEvent(const std::string& id);
+    const GameEvent* getEvent(StringId id) const;
 
 
     const std::vector<GameEvent>& getAllEvents() const;
@@ -128,12 +133,20 @@ public:
                        const std::string& roadType = "") const;
 
 
-    GameEvent* getRandomEvent(float fuel, float energy, int money,
-                            const std::string& location = "",
-                            const std::string& roadType = "");
+    const GameEvent* getRandomEvent(float fuel, float energy, int money,
+                                    const std::string& location = "",
+                                    const std::string& roadType = "");
 
 
     void triggerEvent(const std::string& id);
+    bool isTriggered(StringId id) const;
+
+
+
+
+
+
+    void buildIndex();
 
 
     void resetTriggeredEvents();
@@ -143,6 +156,15 @@ public:
                     float& fuel, float& energy, int& money);
 
 
+
+
+    const RandomOutcome* resolveRandomOutcome(const EventChoice& choice);
+
+
+
+    void setRandomStreams(RandomStream& eventStream, RandomStream& outcomeStream);
+
+
     void setEventCallback(EventCallback callback);
 
 
@@ -156,8 +178,106 @@ public:
     void addPerkChoicesToEvent(GameEvent* event, float playerFuel, float playerEnergy, int playerMoney);
 
 private:
-    std::vector<GameEvent> m_events;
+
+
+    struct EventGate {
+        float minFuel;
+        float maxFuel;
+        float minEnergy;
+        float maxEnergy;
+        int minMoney;
+        int maxMoney;
+        float probability;
+        float weight;
+        bool hasPartyCondition;
+        bool hasRelationshipCondition;
+    };
+
+
+
+
+
+
+    struct EventCatalog {
+        std::vector<GameEvent> events;
+        std::unordered_map<StringId, std::size_t> eventIndex;
+
+        bool indexed = false;
+        std::vector<EventGate> gates;
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> buckets;
+        std::unordered_map<StringId, std::vector<std::size_t>> blockedBy;
+        std::vector<float> minFuelThresholds;
+        std::vector<float> maxFuelThresholds;
+        std::vector<float> minEnergyThresholds;
+        std::vector<float> maxEnergyThresholds;
+        std::vector<int> minMoneyThresholds;
+        std::vector<int> maxMoneyThresholds;
+
+        void rebuildEventIndex();
+        void rebuildEligibilityIndex();
+    };
+
+    std::shared_ptr<EventCatalog> m_catalog;
     EventCallback m_eventCallback;
+    RandomStream* m_random;
+    RandomStream* m_outcomeRandom;
+
+
+
+
+    std::vector<bool> m_triggered;
+    bool m_eligibilityDirty;
+    std::vector<int> m_blockCount;
+
+
+    bool m_npcCacheValid;
+    std::uint32_t m_teamRevision;
+    std::uint32_t m_relationshipRevision;
+    std::vector<bool> m_npcEligible;
+
+
+
+
+
+
+    using ResourceCell = std::array<std::uint32_t, 6>;
+
+    struct SamplerKey {
+        std::uint64_t bucket;
+        ResourceCell cell;
+
+        bool operator==(const SamplerKey& other) const {
+            return bucket == other.bucket && cell == other.cell;
+        }
+    };
+
+    struct SamplerKeyHash {
+        std::size_t operator()(const SamplerKey& key) const;
+    };
+
+    struct BucketSampler {
+        std::vector<std::size_t> events;
+        AliasTable table;
+        float totalWeight = 0.0f;
+        std::vector<std::size_t> zeroWeightEvents;
+    };
+
+    static constexpr std::size_t MAX_CACHED_SAMPLERS = 512;
+    static constexpr int MAX_REJECTION_ATTEMPTS = 8;
+
+    std::unordered_map<SamplerKey, BucketSampler, SamplerKeyHash> m_samplers;
+
+
+    EventCatalog& editCatalog();
+    void rebuildRunState();
+    bool isTriggered(std::size_t eventIndex) const;
+    void refreshNpcCache();
+    ResourceCell findResourceCell(float fuel, float energy, int money) const;
+    const BucketSampler* getBucketSampler(std::uint64_t bucketKey, const ResourceCell& cell,
+                                          float fuel, float energy, int money);
+    void applyTriggered(std::size_t eventIndex, int delta);
+    bool checkPartyCondition(const EventCondition& condition) const;
+    bool checkRelationshipCondition(const EventCondition& condition) const;
 
 
     float randomFloat(float min, float max) const;
@@ -0,0 +1,68 @@
+#ifndef FLAG_SET_H
+#define FLAG_SET_H
+
+#include "StringId.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+
+
+
+
+
+
+
+class FlagRegistry {
+public:
+    static constexpr std::size_t INVALID_INDEX = static_cast<std::size_t>(-1);
+
+    static FlagRegistry& getInstance();
+
+    FlagRegistry(const FlagRegistry&) = delete;
+    FlagRegistry& operator=(const FlagRegistry&) = delete;
+
+
+
+    std::size_t getIndex(StringId flag);
+
+
+    std::size_t findIndex(StringId flag) const;
+
+    std::size_t getFlagCount() const;
+
+private:
+    FlagRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<StringId, std::size_t> m_indices;
+};
+
+
+
+
+class FlagSet {
+public:
+    void add(StringId flag);
+    bool has(StringId flag) const;
+
+    bool containsAll(const FlagSet& required) const;
+
+    bool empty() const;
+    std::size_t count() const;
+    void clear() { m_words.clear(); m_unsatisfiable = false; }
+
+private:
+
+
+    std::vector<std::uint64_t> m_words;
+
+
+
+    bool m_unsatisfiable = false;
+};
+
+#endif
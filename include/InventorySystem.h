@@ -2,6 +2,8 @@
 #define INVENTORY_SYSTEM_H
 
 #include "Item.h"
+#include "StringId.h"
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -50,7 +52,7 @@ public:
 
 
 
-    int removeItemByName(const std::string& itemName, int count);
+    int removeItemByName(StringId itemName, int count);
 
 
 
@@ -66,20 +68,23 @@ public:
     const InventorySlot& getSlot(int slotIndex) const;
 
 
-    InventorySlot& getSlotMutable(int slotIndex);
 
 
 
+    bool setSlot(int slotIndex, const Item& item, int count);
 
 
 
-    bool hasItem(const std::string& itemName, int minCount = 1) const;
 
 
 
+    bool hasItem(StringId itemName, int minCount = 1) const;
 
 
-    int getItemCount(const std::string& itemName) const;
+
+
+
+    int getItemCount(StringId itemName) const;
 
 
 
@@ -115,13 +120,13 @@ public:
 
 
 
-    int findItem(const std::string& itemName) const;
+    int findItem(StringId itemName) const;
 
 
 
 
 
-    std::vector<int> findAllItems(const std::string& itemName) const;
+    std::vector<int> findAllItems(StringId itemName) const;
 
 
 
@@ -167,12 +172,31 @@ public:
 
 
 private:
+    struct ItemIndexEntry {
+        int count = 0;
+        std::vector<int> slots;
+    };
+
     std::vector<InventorySlot> m_slots;
     int m_maxSlots;
     float m_maxWeight;
 
 
 
+
+    double m_totalWeight;
+    int m_emptySlotCount;
+    std::unordered_map<StringId, ItemIndexEntry> m_itemIndex;
+
+
+
+    void indexSlot(int slotIndex);
+    void unindexSlot(int slotIndex);
+    void adjustSlotCount(int slotIndex, int delta);
+    void rebuildIndex();
+
+
+
     int findEmptySlot() const;
 
 
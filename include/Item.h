@@ -1,6 +1,7 @@
 #ifndef ITEM_H
 #define ITEM_H
 
+#include "StringId.h"
 #include <string>
 
 
@@ -33,6 +34,7 @@ enum class ItemRarity {
 
 struct Item {
     std::string name;
+    StringId nameId;
     std::string description;
     ItemCategory category;
     ItemRarity rarity;
@@ -51,6 +53,7 @@ struct Item {
          bool stackable = false,
          int maxStack = 1)
         : name(itemName),
+          nameId(itemName),
           description(itemDescription),
           category(itemCategory),
           rarity(itemRarity),
@@ -62,7 +65,7 @@ struct Item {
 
 
     bool operator==(const Item& other) const {
-        return name == other.name &&
+        return nameId == other.nameId &&
                category == other.category &&
                rarity == other.rarity &&
                value == other.value &&
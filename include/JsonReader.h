@@ -0,0 +1,71 @@
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <string>
+#include <string_view>
+
+
+
+
+
+
+
+
+
+
+
+class JsonHandler {
+public:
+    virtual ~JsonHandler() = default;
+
+    virtual bool startObject() { return true; }
+    virtual bool endObject() { return true; }
+    virtual bool startArray() { return true; }
+    virtual bool endArray() { return true; }
+    virtual bool key(std::string_view name) { (void)name; return true; }
+    virtual bool string(std::string_view value) { (void)value; return true; }
+    virtual bool number(double value) { (void)value; return true; }
+    virtual bool boolean(bool value) { (void)value; return true; }
+    virtual bool null() { return true; }
+};
+
+
+class JsonReader {
+public:
+    static constexpr int MAX_DEPTH = 64;
+
+    JsonReader();
+
+    bool parse(std::string_view text, JsonHandler& handler);
+
+
+    bool parseFile(const std::string& path, JsonHandler& handler);
+
+    const std::string& getError() const { return m_error; }
+    int getLine() const { return m_line; }
+
+private:
+    bool parseValue(int depth);
+    bool parseObject(int depth);
+    bool parseArray(int depth);
+    bool parseString(std::string_view& value);
+    bool parseNumber();
+    bool parseLiteral(std::string_view literal);
+    bool appendCodepoint(unsigned long codepoint);
+    bool readHex4(unsigned long& value);
+
+    void skipWhitespace();
+    bool fail(const char* message);
+    bool handlerStopped();
+
+    std::string_view m_text;
+    std::size_t m_pos;
+    int m_line;
+    JsonHandler* m_handler;
+
+
+    std::string m_scratch;
+    std::string m_error;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef NPC_H
 #define NPC_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -136,6 +137,15 @@ public:
     void setMaxTeamSize(int size) { m_maxTeamSize = size; }
 
 
+
+    std::uint32_t getTeamRevision() const { return m_teamRevision; }
+
+
+
+    std::uint32_t getRelationshipRevision() const { return m_relationshipRevision; }
+    void notifyRelationshipChanged() { m_relationshipRevision++; }
+
+
     void addExperienceToTeam(int exp);
 
 
@@ -151,6 +161,8 @@ private:
 
     std::vector<std::unique_ptr<NPC>> m_team;
     int m_maxTeamSize;
+    std::uint32_t m_teamRevision;
+    std::uint32_t m_relationshipRevision;
 
     static NPCManager* s_instance;
 };
@@ -1,6 +1,8 @@
 #ifndef NOTEBOOK_ENTRY_H
 #define NOTEBOOK_ENTRY_H
 
+#include "FlagSet.h"
+#include "StringId.h"
 #include <string>
 #include <vector>
 #include <functional>
@@ -20,11 +22,37 @@ enum class EntryType {
 
 
 
+enum class ChoiceEffectType {
+    TRAIT,
+    PRINCIPLE,
+    STORY_ITEM,
+    ENERGY,
+    FUEL,
+    MONEY,
+    MOOD,
+    REPUTATION,
+    VEHICLE_CONDITION
+};
+
+
+
+
+struct ChoiceEffect {
+    ChoiceEffectType type = ChoiceEffectType::ENERGY;
+    float amount = 0.0f;
+    StringId id;
+};
+
+
+
+
 struct NotebookChoice {
     std::string text;
     std::function<void(PlayerState*)> action;
+    std::vector<ChoiceEffect> effects;
     std::vector<std::string> nextEntryIds;
     float probability = 1.0f;
+    bool quitsGame = false;
 
 
     float energyRequired = 0.0f;
@@ -34,15 +62,40 @@ struct NotebookChoice {
     std::string disabledReason;
 
 
-    std::vector<std::string> requiredPrinciples;
-    std::vector<std::string> requiredTraits;
-    std::vector<std::string> requiredStoryItems;
     bool isHidden = false;
 
 
 
 
+    void requirePrinciple(StringId principle);
+    void requireTrait(StringId trait);
+    void requireStoryItem(StringId item);
+    void clearRequirements();
+
+    const std::vector<StringId>& getRequiredPrinciples() const { return m_requiredPrinciples; }
+    const std::vector<StringId>& getRequiredTraits() const { return m_requiredTraits; }
+    const std::vector<StringId>& getRequiredStoryItems() const { return m_requiredStoryItems; }
+
+
+
+
     bool isAvailable(const PlayerState* player) const;
+
+
+
+
+    void applyEffects(PlayerState* player) const;
+
+private:
+
+
+
+    std::vector<StringId> m_requiredPrinciples;
+    std::vector<StringId> m_requiredTraits;
+    std::vector<StringId> m_requiredStoryItems;
+    FlagSet m_requiredPrincipleMask;
+    FlagSet m_requiredTraitMask;
+    FlagSet m_requiredStoryItemMask;
 };
 
 
@@ -5,14 +5,17 @@
 #include "PlayerState.h"
 #include "FontLoader.h"
 #include "Notebook/NotebookEntry.h"
+#include "Notebook/StoryContent.h"
 #include "EventManager.h"
+#include "Random.h"
+#include "UI/TextLayout.h"
 #include "ResourceEventSystem.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <memory>
 #include <string>
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 
 
@@ -38,8 +41,7 @@ public:
 
 
 
-    explicit NotebookScene(PlayerState* playerState,
-                          const std::string& initialEntryId = "tutorial_start");
+    explicit NotebookScene(PlayerState* playerState);
 
     ~NotebookScene() override = default;
 
@@ -51,6 +53,8 @@ public:
 
     SceneType getNextScene() const override;
     bool isFinished() const override;
+    bool isIdle() const override;
+    void onEnter() override;
 
 
 
@@ -67,6 +71,16 @@ public:
 
 private:
 
+
+
+
+    const NotebookEntry* findEntry(StringId entryId);
+
+
+
+
+    void prefetchEntries(const std::vector<NotebookChoice>& choices);
+
     PlayerState* m_playerState;
     bool m_isFinished;
     SceneType m_nextScene;
@@ -75,7 +89,8 @@ private:
     std::string m_currentEntryId;
     NotebookEntry m_currentEntry;
     std::string m_fullText;
-    std::string m_revealedText;
+    std::size_t m_revealedCharacters;
+    TextLayout m_textLayout;
 
 
     float m_textRevealTimer;
@@ -89,19 +104,19 @@ private:
     float m_choiceTimer;
 
 
+    const StoryContent& m_content;
     EventManager m_eventManager;
     ResourceEventSystem m_resourceEventSystem;
+    RandomStream* m_random;
     float m_eventTriggerChance;
     std::string m_pendingEventId;
     std::string m_pendingNextEntryId;
 
 
-    std::map<std::string, NotebookEntry> m_entries;
+    std::unordered_map<StringId, NotebookEntry> m_eventEntries;
 
 
-    sf::Font m_fontPresent;
-    sf::Font m_fontPast;
-    sf::Font m_fontThought;
+    const sf::Font* m_font;
     bool m_fontLoaded;
 
 
@@ -168,7 +183,7 @@ private:
 
 
 
-    std::string wrapText(const std::string& text, const sf::Font& font, unsigned int fontSize, float maxWidth) const;
+    void layoutEntryText();
 
 
 
@@ -190,160 +205,6 @@ private:
 
 
     void showEventAsEntry(const std::string& eventId);
-
-
-
-
-
-
-    void loadDay0_KnockOnDoor();
-
-
-
-
-    void loadDay0_Volga();
-
-
-
-
-    void loadDay0_FirstTask();
-
-
-    void loadDay0_BranchA_MapAndTower();
-    void loadDay0_BranchA_Geologist();
-    void loadDay0_BranchA_3();
-    void loadDay0_BranchA_4();
-    void loadDay0_BranchA_5();
-
-
-    void loadDay0_BranchB_Engine();
-    void loadDay0_BranchB_Blacksmith();
-    void loadDay0_BranchB_3();
-    void loadDay0_BranchB_4();
-    void loadDay0_BranchB_5();
-    void loadDay0_BranchB_Driver();
-
-
-    void loadDay0_BranchC_Truck();
-    void loadDay0_BranchC_Teahouse();
-    void loadDay0_BranchC_3();
-    void loadDay0_BranchC_4();
-    void loadDay0_BranchC_5();
-    void loadDay0_BranchC_Package();
-
-
-    void loadDay0_BranchD_Route();
-    void loadDay0_BranchD_Boys();
-    void loadDay0_BranchD_3();
-    void loadDay0_BranchD_4();
-    void loadDay0_BranchD_5();
-    void loadDay0_BranchD_Choice();
-
-
-
-
-
-    void loadDay0_Provocation();
-
-
-
-
-    void loadDay0_GarageFinale();
-
-
-
-
-    void loadDay0_TransitionPresent();
-    void loadDay0_DemoFinale();
-
-
-    void loadDay1_BorderCrossing();
-    void loadDay1_CustomsCheck();
-
-
-
-    void loadTestThoughtSystem();
-    void loadDemoTestResources();
-    void loadDemoTestResources2();
-    void loadDemoTestPrinciples();
-    void loadDemoTestPrinciples2();
-    void loadDemoTestPrinciples3();
-    void loadDemoTestConditional();
-    void loadDemoTestConditional2();
-    void loadDemoTestConditional3();
-    void loadDemoTestConditional4();
-    void loadDemoFullStart();
-    void loadDemoFull1();
-    void loadDemoFull2();
-    void loadDemoFull3();
-    void loadDemoFinale();
-
-
-
-
-
-
-    void loadDemo_Start();
-
-
-
-
-    void loadDemo_Road();
-
-
-
-
-    void loadDemo_Choice();
-
-
-
-
-    void loadDemo_Highway();
-
-
-
-
-    void loadDemo_Backroad();
-
-
-
-
-    void loadDemo_Finale();
-
-
-
-
-    void loadDemo_RestStop();
-
-
-
-
-    void loadDemo_MechanicEncounter();
-
-
-
-
-    void loadDemo_LowFuel();
-
-
-
-
-    void loadDemo_FinalChoice();
-
-
-
-
-    void loadDemo_ForestPath();
-
-
-
-
-    void loadDemo_CityPath();
-
-
-
-
-    void loadDemo_End();
 };
 
 #endif
@@ -0,0 +1,64 @@
+#ifndef STORY_CONTENT_H
+#define STORY_CONTENT_H
+
+#include "Notebook/NotebookEntry.h"
+#include "Notebook/StoryPack.h"
+#include "EventManager.h"
+#include <SFML/Graphics.hpp>
+#include "StringId.h"
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+
+
+
+
+class StoryContent {
+public:
+
+    static StoryContent& getInstance();
+
+
+    StoryContent(const StoryContent&) = delete;
+    StoryContent& operator=(const StoryContent&) = delete;
+
+
+
+
+    const NotebookEntry* findEntry(StringId entryId) const;
+
+
+    bool hasEntry(StringId entryId) const;
+
+
+    const sf::Font* getFont() const;
+
+
+    const EventManager& getEventManager() const { return m_eventManager; }
+
+private:
+    StoryContent();
+    ~StoryContent() = default;
+
+
+
+
+    struct LazyEntry {
+        std::once_flag once;
+        std::optional<NotebookEntry> entry;
+    };
+
+    StoryPack m_pack;
+    std::unordered_map<StringId, std::size_t> m_index;
+    mutable std::vector<LazyEntry> m_entries;
+    EventManager m_eventManager;
+    sf::Font m_font;
+    bool m_fontLoaded;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef STORY_PACK_H
+#define STORY_PACK_H
+
+#include "Notebook/NotebookEntry.h"
+#include "Notebook/StoryPackFormat.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+
+
+
+
+
+
+
+class StoryPack {
+public:
+    class ChoiceView {
+    public:
+        ChoiceView(const StoryPack* pack, const StoryPackFormat::ChoiceRecord* record)
+            : m_pack(pack), m_record(record) {}
+
+        std::string_view getText() const;
+        std::string_view getDisabledReason() const;
+        float getProbability() const { return m_record->probability; }
+        float getEnergyRequired() const { return m_record->energyRequired; }
+        float getFuelRequired() const { return m_record->fuelRequired; }
+        float getMoneyRequired() const { return m_record->moneyRequired; }
+        bool isHidden() const { return (m_record->flags & StoryPackFormat::CHOICE_HIDDEN) != 0; }
+        bool isDisabled() const { return (m_record->flags & StoryPackFormat::CHOICE_DISABLED) != 0; }
+        bool quitsGame() const { return (m_record->flags & StoryPackFormat::CHOICE_QUITS_GAME) != 0; }
+
+        std::size_t getNextEntryCount() const { return m_record->nextEntryIds.count; }
+        std::string_view getNextEntryId(std::size_t index) const;
+
+        std::size_t getRequiredPrincipleCount() const { return m_record->requiredPrinciples.count; }
+        std::string_view getRequiredPrinciple(std::size_t index) const;
+
+        std::size_t getRequiredTraitCount() const { return m_record->requiredTraits.count; }
+        std::string_view getRequiredTrait(std::size_t index) const;
+
+        std::size_t getRequiredStoryItemCount() const { return m_record->requiredStoryItems.count; }
+        std::string_view getRequiredStoryItem(std::size_t index) const;
+
+        std::size_t getEffectCount() const { return m_record->effects.count; }
+        ChoiceEffectType getEffectType(std::size_t index) const;
+        float getEffectAmount(std::size_t index) const;
+        std::string_view getEffectId(std::size_t index) const;
+
+    private:
+        const StoryPack* m_pack;
+        const StoryPackFormat::ChoiceRecord* m_record;
+    };
+
+    class EntryView {
+    public:
+        EntryView(const StoryPack* pack, const StoryPackFormat::EntryRecord* record)
+            : m_pack(pack), m_record(record) {}
+
+        std::string_view getId() const;
+        EntryType getType() const { return static_cast<EntryType>(m_record->type); }
+        std::string_view getText() const;
+        float getPrintSpeed() const { return m_record->printSpeed; }
+        bool canSkip() const { return m_record->canSkip != 0; }
+        std::string_view getDate() const;
+        std::string_view getLocation() const;
+        std::string_view getMood() const;
+        std::string_view getBranchId() const;
+
+        std::size_t getChoiceCount() const { return m_record->choices.count; }
+        ChoiceView getChoice(std::size_t index) const;
+
+    private:
+        const StoryPack* m_pack;
+        const StoryPackFormat::EntryRecord* m_record;
+    };
+
+    StoryPack();
+    ~StoryPack();
+
+    StoryPack(const StoryPack&) = delete;
+    StoryPack& operator=(const StoryPack&) = delete;
+
+
+
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+
+
+    std::size_t getEntryCount() const;
+    EntryView getEntry(std::size_t index) const;
+
+
+
+
+    std::optional<EntryView> findEntry(std::string_view entryId) const;
+
+
+
+
+    NotebookEntry materialize(const EntryView& entry) const;
+
+private:
+    const unsigned char* m_data;
+    std::size_t m_size;
+
+
+
+
+    bool m_mapped;
+    std::vector<unsigned char> m_buffer;
+
+    bool readIntoBuffer(const std::string& path);
+
+    const StoryPackFormat::Header* header() const;
+    std::string_view getString(const StoryPackFormat::StringRef& ref) const;
+    std::string_view getId(std::uint32_t index) const;
+    const StoryPackFormat::ChoiceRecord* getChoiceRecord(std::uint32_t index) const;
+    const StoryPackFormat::EffectRecord* getEffectRecord(std::uint32_t index) const;
+    bool validate() const;
+};
+
+#endif
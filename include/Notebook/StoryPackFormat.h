@@ -0,0 +1,88 @@
+#ifndef STORY_PACK_FORMAT_H
+#define STORY_PACK_FORMAT_H
+
+#include <cstdint>
+
+
+
+
+
+
+
+
+namespace StoryPackFormat {
+
+    const char* const DEFAULT_PATH = "assets/story.pack";
+
+    constexpr char MAGIC[4] = {'K', 'S', 'T', 'P'};
+    constexpr std::uint32_t VERSION = 1;
+
+
+    constexpr std::uint32_t CHOICE_HIDDEN = 1u << 0;
+    constexpr std::uint32_t CHOICE_DISABLED = 1u << 1;
+    constexpr std::uint32_t CHOICE_QUITS_GAME = 1u << 2;
+
+
+    struct StringRef {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+
+    struct Range {
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+
+
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t fileSize;
+
+        Range entries;
+        Range choices;
+        Range ids;
+        Range effects;
+        Range strings;
+    };
+
+
+    struct EntryRecord {
+        StringRef id;
+        std::uint32_t type;
+        float printSpeed;
+        std::uint32_t canSkip;
+        StringRef text;
+        StringRef date;
+        StringRef location;
+        StringRef mood;
+        StringRef branchId;
+        Range choices;
+    };
+
+
+    struct ChoiceRecord {
+        StringRef text;
+        float probability;
+        float energyRequired;
+        float fuelRequired;
+        float moneyRequired;
+        std::uint32_t flags;
+        StringRef disabledReason;
+        Range nextEntryIds;
+        Range requiredPrinciples;
+        Range requiredTraits;
+        Range requiredStoryItems;
+        Range effects;
+    };
+
+
+    struct EffectRecord {
+        std::uint32_t type;
+        float amount;
+        StringRef id;
+    };
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef THOUGHT_SYSTEM_H
 #define THOUGHT_SYSTEM_H
 
+#include "Random.h"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <vector>
@@ -49,6 +50,9 @@ public:
 
     void enableTestMode(bool enabled = true);
 
+
+    void setRandomStream(RandomStream& stream) { m_random = &stream; }
+
 private:
 
 
@@ -67,6 +71,7 @@ private:
     float m_nextThoughtDelay;
     int m_thoughtsSpawned;
     bool m_testMode;
+    RandomStream* m_random;
 
 
     static constexpr float THOUGHT_LIFETIME = 8.0f;
@@ -3,6 +3,8 @@
 
 #include "GameTypes.h"
 #include "InventorySystem.h"
+#include "StringId.h"
+#include "FlagSet.h"
 #include <memory>
 
 
@@ -96,21 +98,25 @@ public:
 
 
 
-    void addPrinciple(const std::string& principleId);
-    void addTrait(const std::string& traitId);
-    void addStoryItem(const std::string& itemId);
+    void addPrinciple(StringId principleId);
+    void addTrait(StringId traitId);
+    void addStoryItem(StringId itemId);
 
-    bool hasPrinciple(const std::string& principleId) const;
-    bool hasTrait(const std::string& traitId) const;
-    bool hasStoryItem(const std::string& itemId) const;
+    bool hasPrinciple(StringId principleId) const;
+    bool hasTrait(StringId traitId) const;
+    bool hasStoryItem(StringId itemId) const;
 
-    const std::vector<std::string>& getPrinciples() const { return m_principles; }
-    const std::vector<std::string>& getTraits() const { return m_traits; }
-    const std::vector<std::string>& getStoryItems() const { return m_storyItems; }
+    const std::vector<StringId>& getPrinciples() const { return m_principles; }
+    const std::vector<StringId>& getTraits() const { return m_traits; }
+    const std::vector<StringId>& getStoryItems() const { return m_storyItems; }
 
-    void clearPrinciples() { m_principles.clear(); }
-    void clearTraits() { m_traits.clear(); }
-    void clearStoryItems() { m_storyItems.clear(); }
+    const FlagSet& getPrincipleFlags() const { return m_principleFlags; }
+    const FlagSet& getTraitFlags() const { return m_traitFlags; }
+    const FlagSet& getStoryItemFlags() const { return m_storyItemFlags; }
+
+    void clearPrinciples() { m_principles.clear(); m_principleFlags.clear(); }
+    void clearTraits() { m_traits.clear(); m_traitFlags.clear(); }
+    void clearStoryItems() { m_storyItems.clear(); m_storyItemFlags.clear(); }
 
 private:
 
@@ -131,9 +137,12 @@ private:
     std::string m_currentNotebookEntryId;
 
 
-    std::vector<std::string> m_principles;
-    std::vector<std::string> m_traits;
-    std::vector<std::string> m_storyItems;
+    std::vector<StringId> m_principles;
+    std::vector<StringId> m_traits;
+    std::vector<StringId> m_storyItems;
+    FlagSet m_principleFlags;
+    FlagSet m_traitFlags;
+    FlagSet m_storyItemFlags;
 };
 
 #endif
@@ -0,0 +1,136 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+
+
+
+
+
+
+
+
+
+class Profiler {
+public:
+    static constexpr std::size_t FRAME_HISTORY = 240;
+    static constexpr std::size_t MAX_EVENTS_PER_FRAME = 1024;
+    static constexpr std::size_t THREAD_BUFFER_CAPACITY = 1024;
+
+
+    struct ZoneEvent {
+        const char* name;
+        std::uint32_t threadId;
+        std::int64_t startMicros;
+        std::int64_t durationMicros;
+    };
+
+
+    struct ZoneTotal {
+        const char* name;
+        std::int64_t totalMicros;
+        std::uint32_t calls;
+    };
+
+    struct FrameStats {
+        std::uint64_t frameIndex = 0;
+        std::int64_t startMicros = 0;
+        std::int64_t durationMicros = 0;
+        std::vector<ZoneEvent> events;
+        std::vector<ZoneTotal> totals;
+        std::size_t droppedEvents = 0;
+    };
+
+    static Profiler& getInstance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+
+
+    void beginFrame();
+    void endFrame();
+
+
+    void recordZone(const char* name, std::int64_t startMicros, std::int64_t endMicros);
+
+    std::int64_t now() const;
+
+
+
+
+    std::size_t getFrameCount() const { return m_completedFrames; }
+    const FrameStats& getFrame(std::size_t age) const;
+
+
+
+
+    std::vector<ZoneTotal> getTopZones(std::size_t count, std::size_t frames) const;
+
+
+
+    bool dumpChromeTrace(const std::string& path) const;
+
+private:
+
+
+
+
+    struct ThreadBuffer {
+        std::uint32_t threadId = 0;
+        std::array<ZoneEvent, THREAD_BUFFER_CAPACITY> events;
+        std::atomic<std::size_t> head{0};
+        std::atomic<std::size_t> tail{0};
+        std::atomic<std::size_t> dropped{0};
+    };
+
+    Profiler();
+
+    static std::uint32_t currentThreadId();
+    ThreadBuffer& getThreadBuffer();
+    void drainThreadBuffers(FrameStats& frame);
+
+    std::atomic<bool> m_enabled;
+    std::chrono::steady_clock::time_point m_epoch;
+
+    std::mutex m_buffersMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+
+    mutable std::mutex m_mutex;
+    std::array<FrameStats, FRAME_HISTORY> m_frames;
+    std::size_t m_current;
+    std::size_t m_completedFrames;
+    std::uint64_t m_nextFrameIndex;
+};
+
+
+
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name);
+    ~ProfileZone();
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_start;
+    bool m_active;
+};
+
+#endif
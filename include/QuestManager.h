@@ -1,9 +1,11 @@
 #ifndef QUEST_MANAGER_H
 #define QUEST_MANAGER_H
 
+#include "StringId.h"
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <functional>
 
 
@@ -113,14 +115,19 @@ public:
 
 
     void registerQuest(const Quest& quest);
-    void registerQuestsFromFile(const std::string& jsonPath);
 
 
-    Quest* getQuest(const std::string& questId);
-    void startQuest(const std::string& questId);
-    void completeQuest(const std::string& questId);
-    void failQuest(const std::string& questId);
-    void resetQuest(const std::string& questId);
+
+
+
+    bool registerQuestsFromFile(const std::string& jsonPath);
+
+
+    Quest* getQuest(StringId questId);
+    void startQuest(StringId questId);
+    void completeQuest(StringId questId);
+    void failQuest(StringId questId);
+    void resetQuest(StringId questId);
 
 
     std::vector<Quest*> getActiveQuests();
@@ -129,9 +136,9 @@ public:
     std::vector<Quest*> getQuestsFromNPC(const std::string& npcId);
 
 
-    void updateObjective(const std::string& questId, int objectiveIndex, int progress);
-    void incrementObjective(const std::string& questId, int objectiveIndex, int amount = 1);
-    void completeObjective(const std::string& questId, int objectiveIndex);
+    void updateObjective(StringId questId, int objectiveIndex, int progress);
+    void incrementObjective(StringId questId, int objectiveIndex, int amount = 1);
+    void completeObjective(StringId questId, int objectiveIndex);
 
 
     void notifyItemCollected(const std::string& itemId, int amount = 1);
@@ -142,7 +149,7 @@ public:
     void notifyMoneyEarned(int amount);
 
 
-    void grantReward(const std::string& questId);
+    void grantReward(StringId questId);
 
 
     void initializeDefaultQuests();
@@ -155,7 +162,31 @@ private:
     QuestManager(const QuestManager&) = delete;
     QuestManager& operator=(const QuestManager&) = delete;
 
-    std::map<std::string, Quest> m_quests;
+    std::unordered_map<StringId, Quest> m_quests;
+
+    Quest& storeQuest(const Quest& quest);
+
+
+
+
+
+    struct ObjectiveRef {
+        Quest* quest;
+        int objectiveIndex;
+    };
+    std::unordered_map<std::uint64_t, std::vector<ObjectiveRef>> m_objectiveIndex;
+
+    static std::uint64_t makeObjectiveKey(QuestObjectiveType type, StringId targetId);
+    void indexQuest(Quest& quest);
+    void unindexQuest(Quest& quest);
+    void setQuestStatus(Quest& quest, QuestStatus status);
+
+
+    template<typename Apply>
+    void dispatchObjectives(QuestObjectiveType type, StringId targetId, Apply apply);
+
+    void applyIncrement(Quest& quest, int objectiveIndex, int amount);
+    void applyComplete(Quest& quest, int objectiveIndex);
 
 
     void checkObjectiveCompletion(Quest& quest);
@@ -0,0 +1,84 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+
+
+
+
+
+
+
+
+
+
+enum class RandomStreamId {
+    EVENTS,
+    EVENT_OUTCOMES,
+    NOTEBOOK,
+    THOUGHTS,
+    COUNT
+};
+
+
+
+
+class RandomStream {
+public:
+    RandomStream(std::uint64_t seed = 0, std::uint64_t streamKey = 0);
+
+    void reseed(std::uint64_t seed);
+
+    std::uint64_t nextU64();
+
+
+    float nextFloat();
+
+
+    float range(float min, float max);
+
+
+    int rangeInt(int min, int max);
+
+
+    bool chance(float probability);
+
+    std::uint64_t getCounter() const { return m_counter; }
+    void setCounter(std::uint64_t counter) { m_counter = counter; }
+
+private:
+    std::uint64_t m_key;
+    std::uint64_t m_streamKey;
+    std::uint64_t m_counter;
+};
+
+
+
+
+
+
+class RandomService {
+public:
+    static RandomService& getInstance();
+
+    RandomService(const RandomService&) = delete;
+    RandomService& operator=(const RandomService&) = delete;
+
+
+    void setSeed(std::uint64_t seed);
+    std::uint64_t getSeed() const { return m_seed; }
+
+    RandomStream& getStream(RandomStreamId id);
+
+private:
+    RandomService();
+
+    std::uint64_t m_seed;
+    std::array<RandomStream, static_cast<std::size_t>(RandomStreamId::COUNT)> m_streams;
+};
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef SAVE_FORMAT_H
+#define SAVE_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+
+
+
+
+
+
+
+
+namespace SaveFormat {
+
+    constexpr char MAGIC[4] = {'K', 'K', 'B', 'S'};
+
+
+    constexpr std::uint32_t TEXT_VERSION = 1;
+    constexpr std::uint32_t VERSION = 3;
+
+    constexpr std::uint32_t makeTag(char a, char b, char c, char d) {
+        return static_cast<std::uint32_t>(static_cast<unsigned char>(a)) |
+               static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8 |
+               static_cast<std::uint32_t>(static_cast<unsigned char>(c)) << 16 |
+               static_cast<std::uint32_t>(static_cast<unsigned char>(d)) << 24;
+    }
+
+    constexpr std::uint32_t TAG_PLAYER = makeTag('P', 'L', 'Y', 'R');
+    constexpr std::uint32_t TAG_INVENTORY = makeTag('I', 'N', 'V', 'T');
+    constexpr std::uint32_t TAG_EXPERIENCE = makeTag('E', 'X', 'P', 'R');
+    constexpr std::uint32_t TAG_QUESTS = makeTag('Q', 'U', 'S', 'T');
+    constexpr std::uint32_t TAG_NPCS = makeTag('N', 'P', 'C', 'S');
+    constexpr std::uint32_t TAG_DIALOGUE = makeTag('D', 'L', 'G', 'H');
+    constexpr std::uint32_t TAG_FLAGS = makeTag('F', 'L', 'A', 'G');
+
+
+
+    constexpr std::uint32_t FIRST_HASHED_DIALOGUE_VERSION = 3;
+
+
+    bool isBinary(std::string_view data);
+
+
+    void appendU32(std::string& out, std::uint32_t value);
+    std::uint32_t loadU32(const char* bytes);
+
+
+
+
+
+
+    constexpr char METADATA_MAGIC[4] = {'K', 'K', 'M', 'D'};
+    constexpr std::uint32_t METADATA_VERSION = 1;
+    constexpr std::size_t METADATA_SIZE = 128;
+    constexpr std::size_t MAX_METADATA_ENTRY_ID = 88;
+
+    struct SlotMetadata {
+        std::int64_t timestamp = 0;
+        float playTimeSeconds = 0.0f;
+        std::int32_t level = 0;
+        std::int32_t currentNodeId = 0;
+        std::uint32_t thumbnailHash = 0;
+        std::string currentNotebookEntryId;
+    };
+
+    std::string encodeMetadata(const SlotMetadata& metadata);
+    bool decodeMetadata(std::string_view data, SlotMetadata& metadata);
+
+
+
+
+    class Writer {
+    public:
+        explicit Writer(std::uint32_t version = VERSION, const char* magic = MAGIC);
+
+        void beginSection(std::uint32_t tag);
+        void endSection();
+
+        void writeU32(std::uint32_t value);
+        void writeI32(std::int32_t value);
+        void writeI64(std::int64_t value);
+        void writeF32(float value);
+        void writeBool(bool value);
+        void writeString(std::string_view value);
+
+        std::string finish();
+
+    private:
+        void patchU32(std::size_t offset, std::uint32_t value);
+
+        std::string m_data;
+        std::size_t m_sectionStart;
+        std::uint32_t m_sectionCount;
+    };
+
+
+
+
+
+    class Reader {
+    public:
+        Reader() : m_offset(0), m_ok(false) {}
+        explicit Reader(std::string_view data) : m_data(data), m_offset(0), m_ok(true) {}
+
+        std::uint32_t readU32();
+        std::int32_t readI32();
+        std::int64_t readI64();
+        float readF32();
+        bool readBool();
+        std::string_view readString();
+
+
+
+        std::uint32_t readCount(std::size_t minElementSize);
+
+        bool ok() const { return m_ok; }
+        bool atEnd() const { return m_offset >= m_data.size(); }
+
+    private:
+        bool require(std::size_t size);
+
+        std::string_view m_data;
+        std::size_t m_offset;
+        bool m_ok;
+    };
+
+
+
+
+    struct Section {
+        std::uint32_t tag;
+        std::string_view body;
+    };
+
+    class File {
+    public:
+        bool open(std::string_view data);
+
+        std::uint32_t getVersion() const { return m_version; }
+        std::uint32_t getSectionCount() const { return m_sectionCount; }
+
+
+        bool nextSection(Section& section);
+
+
+        bool isComplete() const;
+
+    private:
+        Reader m_reader;
+        std::uint32_t m_version = 0;
+        std::uint32_t m_sectionCount = 0;
+        std::uint32_t m_sectionsRead = 0;
+    };
+}
+
+#endif
@@ -2,7 +2,20 @@
 #define SAVE_SYSTEM_H
 
 #include "PlayerState.h"
+#include "SaveFormat.h"
+#include "StringId.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 
@@ -10,62 +23,266 @@
 
 
 
+struct SaveSnapshot {
+    struct ObjectiveState {
+        int type;
+        int currentAmount;
+        int targetAmount;
+        bool completed;
+    };
+
+    struct QuestState {
+        std::string id;
+        int status;
+        std::vector<ObjectiveState> objectives;
+    };
+
+    struct NPCState {
+        std::string id;
+        std::string name;
+        int level;
+        int experience;
+        std::string passiveAbilityId;
+        std::string activeAbilityId;
+    };
+
+    struct ItemState {
+        int slot;
+        int count;
+        std::string name;
+        std::string description;
+        int category;
+        int rarity;
+        int value;
+        float weight;
+        bool stackable;
+        int maxStackSize;
+    };
+
+    struct DialogueState {
+        std::string dialogueId;
+        std::vector<StringId> choices;
+    };
+
+
+
+    std::uint32_t version = SaveFormat::VERSION;
+    std::time_t timestamp = 0;
+    float playTime = 0.0f;
+
+    float energy = 0.0f;
+    float money = 0.0f;
+    float fuel = 0.0f;
+    float vehicleCondition = 0.0f;
+    float mood = 0.0f;
+    int reputation = 0;
+    int origin = 0;
+    int carType = 0;
+    int currentNodeId = 0;
+    std::string currentNotebookEntryId;
+
+    int level = 0;
+    int experience = 0;
+    std::vector<std::string> unlockedAbilities;
+
+    std::vector<QuestState> quests;
+    std::vector<NPCState> npcs;
+
+
+
+    bool hasInventory = false;
+    float maxInventoryWeight = 0.0f;
+    std::vector<ItemState> inventory;
+
+    bool hasDialogueHistory = false;
+    std::vector<DialogueState> dialogueHistory;
+    std::vector<StringId> dialogueFlags;
+
+    std::vector<std::string> principles;
+    std::vector<std::string> traits;
+    std::vector<std::string> storyItems;
+};
+
+
+
+
+
+
 
 
 
 
 class SaveSystem {
 public:
+    using Migration = std::function<bool(SaveSnapshot&)>;
+
     SaveSystem();
+    ~SaveSystem();
+
+    SaveSystem(const SaveSystem&) = delete;
+    SaveSystem& operator=(const SaveSystem&) = delete;
 
 
 
     bool saveGame(const PlayerState& playerState);
 
 
+
+
+
+    void saveGameAsync(const PlayerState& playerState);
+
+
+
+    void waitForPendingSaves();
+    bool isSavePending() const;
+
+
+
+    SaveSnapshot captureSnapshot(const PlayerState& playerState) const;
+
+
+    bool saveSnapshot(const SaveSnapshot& snapshot);
+
+
+
+
+
+    bool saveIncremental(const SaveSnapshot& snapshot);
+
+
     bool loadGame(PlayerState& playerState);
 
 
     bool loadBackup(PlayerState& playerState, int backupIndex);
 
 
+
+
+
+
+    void registerMigration(std::uint32_t fromVersion, std::uint32_t toVersion, Migration migration);
+
+
+
+    void setDebugTextExport(bool enabled) { m_debugTextExport = enabled; }
+    bool exportDebugText(const PlayerState& playerState, const std::string& filename) const;
+
+
     bool hasSaveFile() const;
 
 
     bool hasBackup(int backupIndex) const;
 
 
+
+
+
+
     struct BackupInfo {
         int index;
         std::string timestamp;
         int nodeId;
         bool exists;
+        bool hasMetadata = false;
+        std::time_t savedAt = 0;
+        float playTime = 0.0f;
+        int level = 0;
+        std::string currentNotebookEntryId;
+        std::uint32_t thumbnailHash = 0;
     };
     std::vector<BackupInfo> getBackupList() const;
+    BackupInfo getSaveInfo() const;
 
 
     void clearAllSaves();
 
 private:
+    enum SaveSection : unsigned {
+        SECTION_PLAYER = 1u << 0,
+        SECTION_INVENTORY = 1u << 1,
+        SECTION_EXPERIENCE = 1u << 2,
+        SECTION_QUESTS = 1u << 3,
+        SECTION_NPCS = 1u << 4,
+        SECTION_DIALOGUE = 1u << 5,
+        SECTION_FLAGS = 1u << 6,
+        ALL_SECTIONS = (1u << 7) - 1
+    };
+
 
-    std::string serializePlayerState(const PlayerState& playerState) const;
-    bool deserializePlayerState(const std::string& data, PlayerState& playerState) const;
+    std::string serializeSnapshot(const SaveSnapshot& snapshot) const;
+    std::string serializeSections(const SaveSnapshot& snapshot, unsigned sections) const;
+    bool serializeDelta(const SaveSnapshot& previous, const SaveSnapshot& current, std::string& record) const;
+    std::string serializeSnapshotText(const SaveSnapshot& snapshot) const;
 
 
-    bool writeToFile(const std::string& filename, const std::string& data);
+    bool decodeSnapshot(const std::string& data, SaveSnapshot& snapshot) const;
+    bool decodeBinarySnapshot(std::string_view data, SaveSnapshot& snapshot) const;
+    bool decodeTextSnapshot(const std::string& data, SaveSnapshot& snapshot) const;
+    bool migrateSnapshot(SaveSnapshot& snapshot) const;
+    void applySnapshot(const SaveSnapshot& snapshot, PlayerState& playerState) const;
+
+
+    bool writeToFile(const std::string& filename, const std::string& data, const std::string& metadata);
     std::string readFromFile(const std::string& filename) const;
+    bool readVerified(const std::string& filename, std::string& payload) const;
+    bool readMetadata(const std::string& filename, SaveFormat::SlotMetadata& metadata) const;
+    BackupInfo readSlotInfo(int index, const std::string& filename) const;
+
+
+    bool loadFromFile(const std::string& filename, PlayerState& playerState, bool withJournal = false);
+    bool loadNewestBackup(PlayerState& playerState, int firstIndex);
     bool fileExists(const std::string& filename) const;
 
 
     void rotateBackups();
 
 
+    bool appendJournal(const std::string& record);
+    int replayJournal(std::uint32_t baseChecksum, SaveSnapshot& snapshot) const;
+    void resetJournal();
+    void updateSaveMetadata(const SaveSnapshot& snapshot);
+
+
     std::string getSaveFilePath() const;
     std::string getBackupFilePath(int index) const;
+    std::string getDebugTextFilePath() const;
+    std::string getJournalFilePath() const;
+    std::string getMetadataFilePath() const;
+
+
+    void saveWorkerLoop();
 
 
     std::string m_saveDirectory;
     static constexpr int MAX_BACKUPS = 4;
+
+    std::map<std::pair<std::uint32_t, std::uint32_t>, Migration> m_migrations;
+    std::atomic<bool> m_debugTextExport;
+
+
+
+
+    std::atomic<bool> m_newerSaveOnDisk;
+
+
+
+
+
+    static constexpr int JOURNAL_COMPACT_RECORDS = 32;
+    static constexpr std::size_t JOURNAL_COMPACT_BYTES = 64 * 1024;
+    std::optional<SaveSnapshot> m_lastSaved;
+    std::uint32_t m_journalBaseChecksum;
+    int m_journalRecords;
+    std::size_t m_journalBytes;
+
+
+    std::thread m_saveWorker;
+    mutable std::mutex m_saveMutex;
+    std::condition_variable m_saveCondition;
+    std::optional<SaveSnapshot> m_pendingSnapshot;
+    bool m_saveInProgress;
+    bool m_stopSaveWorker;
 };
 
 #endif
@@ -40,6 +40,19 @@ public:
 
 
     virtual bool isFinished() const = 0;
+
+
+
+
+
+    virtual bool isIdle() const { return false; }
+
+
+
+
+
+
+    virtual void onEnter() {}
 };
 
 #endif
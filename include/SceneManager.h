@@ -1,9 +1,14 @@
 #ifndef SCENE_MANAGER_H
 #define SCENE_MANAGER_H
 
+#include <future>
 #include <memory>
+#include <string>
 #include <SFML/Graphics.hpp>
 #include "Scene.h"
+#include "UI/ProfilerOverlay.h"
+
+class PlayerState;
 
 
 
@@ -17,11 +22,46 @@ public:
 
     void run();
 
+
+
+
+    void setFrameRateLimit(unsigned int framesPerSecond);
+    void setVerticalSyncEnabled(bool enabled);
+
+
+
+    void setIdleTimeout(sf::Time timeout) { m_idleTimeout = timeout; }
+
+
+
+
+
+
+    void preloadScene(SceneType type);
+
+
+
+    bool isSceneLoading(SceneType type) const;
+
 private:
 
+
+
     std::unique_ptr<Scene> createScene(SceneType type);
 
 
+
+    static std::unique_ptr<Scene> buildScene(SceneType type, PlayerState* playerState);
+
+
+
+
+    std::unique_ptr<Scene> takePreloadedScene(SceneType type);
+
+
+    static SceneType predictNextScene(SceneType current);
+
+
     sf::RenderWindow& m_window;
 
 
@@ -29,6 +69,26 @@ private:
 
 
     SceneType m_currentSceneType;
+
+
+    sf::Time m_frameDuration;
+    bool m_verticalSync;
+    sf::Time m_idleTimeout;
+
+
+    std::future<std::unique_ptr<Scene>> m_preload;
+    SceneType m_preloadType;
+
+
+    ProfilerOverlay m_profilerOverlay;
+
+
+
+    bool m_profilingBeforeOverlay;
+
+
+
+    bool dispatchEvent(const sf::Event& event);
 };
 
 #endif
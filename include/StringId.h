@@ -0,0 +1,97 @@
+#ifndef STRING_ID_H
+#define STRING_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+
+
+
+
+
+
+
+namespace StringIdHash {
+
+    constexpr std::uint32_t OFFSET_BASIS = 2166136261u;
+    constexpr std::uint32_t PRIME = 16777619u;
+
+
+    constexpr std::uint32_t fnv1a(const char* text, std::size_t length) {
+        if (length == 0) {
+            return 0;
+        }
+        std::uint32_t hash = OFFSET_BASIS;
+        for (std::size_t i = 0; i < length; i++) {
+            hash ^= static_cast<std::uint8_t>(text[i]);
+            hash *= PRIME;
+        }
+        return hash;
+    }
+}
+
+
+class StringId {
+public:
+
+    constexpr StringId() : m_hash(0) {}
+
+
+
+    StringId(std::string_view name);
+    StringId(const std::string& name) : StringId(std::string_view(name)) {}
+    StringId(const char* name) : StringId(std::string_view(name)) {}
+
+
+
+    static constexpr StringId fromHash(std::uint32_t hash) { return StringId(hash, 0); }
+
+    constexpr std::uint32_t getHash() const { return m_hash; }
+    constexpr bool isValid() const { return m_hash != 0; }
+
+
+
+    const std::string& str() const;
+
+
+
+
+
+
+    static std::size_t getInternErrorCount();
+
+    constexpr bool operator==(const StringId& other) const { return m_hash == other.m_hash; }
+    constexpr bool operator!=(const StringId& other) const { return m_hash != other.m_hash; }
+    constexpr bool operator<(const StringId& other) const { return m_hash < other.m_hash; }
+
+private:
+    constexpr StringId(std::uint32_t hash, int) : m_hash(hash) {}
+
+    std::uint32_t m_hash;
+};
+
+
+
+constexpr StringId operator""_sid(const char* text, std::size_t length) {
+    return StringId::fromHash(StringIdHash::fnv1a(text, length));
+}
+
+inline std::ostream& operator<<(std::ostream& os, const StringId& id) {
+    return os << id.str();
+}
+
+namespace std {
+    template<>
+    struct hash<StringId> {
+        std::size_t operator()(const StringId& id) const noexcept {
+            return id.getHash();
+        }
+    };
+}
+
+#endif
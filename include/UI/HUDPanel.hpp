@@ -22,6 +22,12 @@
 //    - Cargo: 📦 25/64 (white text)
 //
 // The HUD uses pixel/bitmap fonts and retro styling with rectangles and text.
+//
+// The bottom panel is drawn from cached geometry: static chrome (backgrounds,
+// panel frames) is baked into one vertex array when the layout is built, the
+// bar fills and warning lamps into a second one that is rebuilt only when
+// update() receives different values. Both are composited together with the
+// labels into an off-screen layer, so an unchanged HUD costs a single draw.
 
 class HUDPanel {
 public:
@@ -132,7 +138,7 @@ private:
     std::optional<sf::Text> m_tempText;
     std::optional<sf::Text> m_tempValue;
 
-    // Warning indicators
+    // Warning indicators (lamp fill colour follows the warning state)
     sf::RectangleShape m_warningEngine;
     std::optional<sf::Text> m_warningEngineText;
 
@@ -142,12 +148,31 @@ private:
     sf::RectangleShape m_warningCheck;
     std::optional<sf::Text> m_warningCheckText;
     
+    // === Cached geometry ===
+    // The rectangle shapes above only describe the layout; they are never
+    // drawn directly. Their geometry is flattened into these arrays.
+    sf::VertexArray m_chromeVertices;   // Panel fills and outlines, built once
+    sf::VertexArray m_dynamicVertices;  // Bar fills and warning lamps
+
+    // Off-screen layer holding the composited bottom panel
+    sf::RenderTexture m_layer;
+    std::optional<sf::Sprite> m_layerSprite;
+    float m_layerTop;                   // Window Y of the layer's first row
+    bool m_layerReady;                  // False if the render texture is unavailable
+    bool m_layerDirty;                  // Recomposite before the next draw
+
     // Helper functions
     void initializeLayout();
     void initializeLeftSection();
     void initializeCenterSection();
     void initializeRightSection();
+    void initializeLayer();
+    void applyData(const HUDData& data, bool force);
     void updateBars();
+    void buildChromeVertices();
+    void buildDynamicVertices();
+    void drawPanel(sf::RenderTarget& target) const;
+    void composeLayer();
     
     // === Phase 4: Top-right resource display ===
     bool m_topRightEnabled;
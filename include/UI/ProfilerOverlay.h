@@ -0,0 +1,45 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <optional>
+
+
+
+
+
+
+
+
+
+
+class ProfilerOverlay {
+public:
+    ProfilerOverlay();
+
+    void toggle() { m_visible = !m_visible; }
+    void setVisible(bool visible) { m_visible = visible; }
+    bool isVisible() const { return m_visible; }
+
+    void render(sf::RenderTarget& target);
+
+private:
+    static constexpr float GRAPH_WIDTH = 240.0f;
+    static constexpr float GRAPH_HEIGHT = 80.0f;
+    static constexpr float GRAPH_MAX_MS = 50.0f;
+    static constexpr std::size_t TOP_ZONE_COUNT = 6;
+    static constexpr std::size_t AVERAGE_FRAMES = 60;
+
+    void buildGraph();
+    void buildText();
+
+    bool m_visible;
+    sf::Vector2f m_position;
+
+    sf::VertexArray m_graph;
+    sf::Font m_font;
+    bool m_fontLoaded;
+    std::optional<sf::Text> m_text;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+
+
+
+
+
+
+
+
+
+
+class TextLayout {
+public:
+    TextLayout();
+
+
+
+
+    void build(const std::string& text,
+               const sf::Font& font,
+               unsigned int characterSize,
+               float maxWidth,
+               float lineSpacing,
+               sf::Color color);
+
+
+    void clear();
+
+    void revealCharacters(std::size_t characterCount);
+    void revealAll();
+
+    bool isFullyRevealed() const { return m_visibleVertices == m_vertices.size(); }
+    std::size_t getCharacterCount() const { return m_codePoints.size(); }
+    sf::Vector2f getSize() const { return m_size; }
+
+    void render(sf::RenderWindow& window, sf::Vector2f position) const;
+
+private:
+    struct WordSpan {
+        std::size_t first;
+        std::size_t last;
+        float width;
+    };
+
+    const sf::Glyph& getGlyph(char32_t codePoint);
+    void appendGlyph(const sf::Glyph& glyph, float x, float y);
+
+    const sf::Font* m_font;
+    unsigned int m_characterSize;
+    sf::Color m_color;
+
+    std::vector<sf::Vertex> m_vertices;
+
+
+
+    std::vector<std::size_t> m_vertexEnd;
+    std::size_t m_visibleVertices;
+    sf::Vector2f m_size;
+
+
+
+    const sf::Font* m_cachedFont;
+    std::unordered_map<std::uint64_t, sf::Glyph> m_glyphCache;
+
+
+    std::vector<char32_t> m_codePoints;
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 #include <functional>
@@ -37,7 +38,10 @@ public:
     UIComponent(const sf::Vector2f& position = {0.f, 0.f},
                 const sf::Vector2f& size = {0.f, 0.f});
 
-    virtual ~UIComponent() = default;
+    virtual ~UIComponent();
+
+    UIComponent(const UIComponent&) = delete;
+    UIComponent& operator=(const UIComponent&) = delete;
 
 
 
@@ -56,7 +60,26 @@ public:
 
 
 
-    virtual void render(sf::RenderWindow& window) = 0;
+    virtual void render(sf::RenderTarget& target) = 0;
+
+
+
+
+
+
+    void draw(sf::RenderTarget& target);
+
+
+
+
+    void markDirty();
+    bool isDirty() const { return m_dirty; }
+
+
+
+
+    void setCacheEnabled(bool enabled);
+    bool isCacheEnabled() const { return m_cacheEnabled; }
 
 
     void setPosition(const sf::Vector2f& position);
@@ -66,9 +89,15 @@ public:
     sf::FloatRect getBounds() const;
 
 
-    void setVisible(bool visible) { m_visible = visible; }
+
+
+    virtual sf::FloatRect getVisualBounds() const { return getBounds(); }
+    sf::FloatRect getSubtreeBounds() const;
+
+
+    void setVisible(bool visible);
     bool isVisible() const { return m_visible; }
-    void setEnabled(bool enabled) { m_enabled = enabled; }
+    void setEnabled(bool enabled);
     bool isEnabled() const { return m_enabled; }
 
 
@@ -76,6 +105,7 @@ public:
     void removeChild(std::shared_ptr<UIComponent> child);
     void clearChildren();
     const std::vector<std::shared_ptr<UIComponent>>& getChildren() const { return m_children; }
+    UIComponent* getParent() const { return m_parent; }
 
 
     void setId(const std::string& id) { m_id = id; }
@@ -105,11 +135,25 @@ protected:
 
 
     std::vector<std::shared_ptr<UIComponent>> m_children;
+    UIComponent* m_parent;
 
 
-    void renderChildren(sf::RenderWindow& window);
+    bool m_dirty;
+    bool m_cacheEnabled;
+    std::unique_ptr<sf::RenderTexture> m_cache;
+    std::optional<sf::Sprite> m_cacheSprite;
+
+
+
+
+    virtual void onLayoutChanged() {}
+
+    void renderChildren(sf::RenderTarget& target);
     void updateChildren(float deltaTime);
     bool handleChildrenInput(const sf::Event& event);
+
+private:
+    bool refreshCache();
 };
 
 
@@ -120,11 +164,15 @@ public:
     UIPanel(const sf::Vector2f& position, const sf::Vector2f& size,
             const sf::Color& backgroundColor = sf::Color(40, 40, 50));
 
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& target) override;
+    sf::FloatRect getVisualBounds() const override { return m_shape.getGlobalBounds(); }
 
-    void setBackgroundColor(const sf::Color& color) { m_backgroundColor = color; }
-    void setBorderColor(const sf::Color& color) { m_borderColor = color; }
-    void setBorderThickness(float thickness) { m_borderThickness = thickness; }
+    void setBackgroundColor(const sf::Color& color);
+    void setBorderColor(const sf::Color& color);
+    void setBorderThickness(float thickness);
+
+protected:
+    void onLayoutChanged() override;
 
 private:
     sf::Color m_backgroundColor;
@@ -141,15 +189,19 @@ public:
     UILabel(const sf::Font& font, const std::string& text, const sf::Vector2f& position,
             unsigned int fontSize = 16);
 
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& target) override;
+    sf::FloatRect getVisualBounds() const override { return m_text.getGlobalBounds(); }
 
     void setText(const std::string& text);
     std::string getText() const { return m_text.getString(); }
 
-    void setFont(const sf::Font& font) { m_text.setFont(font); }
-    void setFontSize(unsigned int size) { m_text.setCharacterSize(size); }
-    void setTextColor(const sf::Color& color) { m_text.setFillColor(color); }
-    void setStyle(uint32_t style) { m_text.setStyle(static_cast<sf::Text::Style>(style)); }
+    void setFont(const sf::Font& font) { m_text.setFont(font); markDirty(); }
+    void setFontSize(unsigned int size) { m_text.setCharacterSize(size); markDirty(); }
+    void setTextColor(const sf::Color& color) { m_text.setFillColor(color); markDirty(); }
+    void setStyle(uint32_t style) { m_text.setStyle(static_cast<sf::Text::Style>(style)); markDirty(); }
+
+protected:
+    void onLayoutChanged() override;
 
 private:
     sf::Text m_text;
@@ -165,24 +217,31 @@ public:
     UIButton(const sf::Font& font, const std::string& text, const sf::Vector2f& position,
              const sf::Vector2f& size);
 
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& target) override;
     bool handleInput(const sf::Event& event) override;
     void update(float deltaTime) override;
+    sf::FloatRect getVisualBounds() const override;
 
     void setText(const std::string& text);
     void setCallback(ClickCallback callback) { m_callback = callback; }
 
 
-    void setNormalColor(const sf::Color& color) { m_normalColor = color; }
-    void setHoverColor(const sf::Color& color) { m_hoverColor = color; }
-    void setPressedColor(const sf::Color& color) { m_pressedColor = color; }
-    void setDisabledColor(const sf::Color& color) { m_disabledColor = color; }
-    void setTextColor(const sf::Color& color) { m_textColor = color; }
+    void setNormalColor(const sf::Color& color) { m_normalColor = color; refreshColor(); }
+    void setHoverColor(const sf::Color& color) { m_hoverColor = color; refreshColor(); }
+    void setPressedColor(const sf::Color& color) { m_pressedColor = color; refreshColor(); }
+    void setDisabledColor(const sf::Color& color) { m_disabledColor = color; refreshColor(); }
+    void setTextColor(const sf::Color& color);
 
     void onMouseEnter() override;
     void onMouseLeave() override;
 
+protected:
+    void onLayoutChanged() override;
+
 private:
+    void refreshColor();
+    void centerText();
+
     sf::RectangleShape m_shape;
     sf::Text m_text;
     ClickCallback m_callback;
@@ -206,18 +265,24 @@ public:
     UIProgressBar(const sf::Vector2f& position, const sf::Vector2f& size,
                   float minValue = 0.f, float maxValue = 100.f);
 
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& target) override;
+    sf::FloatRect getVisualBounds() const override { return m_background.getGlobalBounds(); }
 
     void setValue(float value);
     float getValue() const { return m_value; }
     float getProgress() const { return (m_value - m_minValue) / (m_maxValue - m_minValue); }
 
-    void setMinMax(float min, float max) { m_minValue = min; m_maxValue = max; }
-    void setBarColor(const sf::Color& color) { m_barColor = color; }
-    void setBackgroundColor(const sf::Color& color) { m_backgroundColor = color; }
-    void setBorderColor(const sf::Color& color) { m_borderColor = color; }
+    void setMinMax(float min, float max);
+    void setBarColor(const sf::Color& color);
+    void setBackgroundColor(const sf::Color& color);
+    void setBorderColor(const sf::Color& color);
+
+protected:
+    void onLayoutChanged() override;
 
 private:
+    void updateBarShape();
+
     float m_value;
     float m_minValue;
     float m_maxValue;
@@ -238,10 +303,14 @@ public:
     UIImage(const sf::Texture& texture, const sf::Vector2f& position,
             const sf::Vector2f& size = {0.f, 0.f});
 
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderTarget& target) override;
+    sf::FloatRect getVisualBounds() const override { return m_sprite.getGlobalBounds(); }
 
     void setTexture(const sf::Texture& texture);
-    void setColor(const sf::Color& color) { m_sprite.setColor(color); }
+    void setColor(const sf::Color& color) { m_sprite.setColor(color); markDirty(); }
+
+protected:
+    void onLayoutChanged() override;
 
 private:
     sf::Sprite m_sprite;
@@ -0,0 +1,84 @@
+#include "AliasTable.h"
+#include <algorithm>
+
+
+void AliasTable::build(const std::vector<float>& weights) {
+    const std::size_t n = weights.size();
+    m_probability.assign(n, 1.0f);
+    m_alias.resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+        m_alias[i] = i;
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    float totalWeight = 0.0f;
+    for (float weight : weights) {
+        totalWeight += std::max(0.0f, weight);
+    }
+
+
+    if (totalWeight <= 0.0f) {
+        return;
+    }
+
+
+    std::vector<float> scaled(n);
+    std::vector<std::size_t> small;
+    std::vector<std::size_t> large;
+    small.reserve(n);
+    large.reserve(n);
+
+    for (std::size_t i = 0; i < n; i++) {
+        scaled[i] = std::max(0.0f, weights[i]) * static_cast<float>(n) / totalWeight;
+        if (scaled[i] < 1.0f) {
+            small.push_back(i);
+        } else {
+            large.push_back(i);
+        }
+    }
+
+    while (!small.empty() && !large.empty()) {
+        std::size_t less = small.back();
+        small.pop_back();
+        std::size_t more = large.back();
+
+        m_probability[less] = scaled[less];
+        m_alias[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0f;
+        if (scaled[more] < 1.0f) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+
+    for (std::size_t i : large) {
+        m_probability[i] = 1.0f;
+    }
+    for (std::size_t i : small) {
+        m_probability[i] = 1.0f;
+    }
+}
+
+std::size_t AliasTable::sample(float column, float coin) const {
+    if (m_probability.empty()) {
+        return 0;
+    }
+
+    const std::size_t n = m_probability.size();
+    std::size_t index = static_cast<std::size_t>(column * static_cast<float>(n));
+    if (index >= n) {
+        index = n - 1;
+    }
+
+    return coin < m_probability[index] ? index : m_alias[index];
+}
+
+void AliasTable::clear() {
+    m_probability.clear();
+    m_alias.clear();
+}
@@ -1,15 +1,127 @@
 #include "DialogueManager.h"
 #include "NPC.h"
+#include "PlayerState.h"
 #include <iostream>
 
 
+namespace {
+
+std::uint64_t makeChoiceKey(StringId dialogueId, StringId choiceId) {
+    return static_cast<std::uint64_t>(dialogueId.getHash()) << 32 | choiceId.getHash();
+}
+
+}
+
+
+const CompiledDialogue::Choice* CompiledDialogue::getChoice(const Node& node, int choiceIndex) const {
+    if (choiceIndex < 0 || choiceIndex >= static_cast<int>(node.choiceCount)) {
+        return nullptr;
+    }
+    return &choices[node.firstChoice + static_cast<std::uint32_t>(choiceIndex)];
+}
+
+int CompiledDialogue::findNode(const std::string& nodeId) const {
+    for (std::size_t i = 0; i < nodeIds.size(); i++) {
+        if (nodeIds[i] == nodeId) {
+            return static_cast<int>(i);
+        }
+    }
+    return END_NODE;
+}
+
+bool compileDialogue(const DialogueTree& tree, CompiledDialogue& compiled) {
+    compiled = CompiledDialogue();
+    compiled.id = tree.id;
+    compiled.title = tree.title;
+
+    if (tree.nodes.find(tree.startNodeId) == tree.nodes.end()) {
+        std::cerr << "Start node not found in dialogue: " << tree.id << std::endl;
+        return false;
+    }
+
+
+
+    compiled.nodeIds.reserve(tree.nodes.size());
+    compiled.nodeIds.push_back(tree.startNodeId);
+    std::size_t choiceTotal = 0;
+    for (const auto& [nodeId, node] : tree.nodes) {
+        if (nodeId != tree.startNodeId) {
+            compiled.nodeIds.push_back(nodeId);
+        }
+        choiceTotal += node.choices.size();
+    }
+
+    std::unordered_map<std::string, int> indices;
+    for (std::size_t i = 0; i < compiled.nodeIds.size(); i++) {
+        indices[compiled.nodeIds[i]] = static_cast<int>(i);
+    }
+
+    compiled.startNode = 0;
+    compiled.nodes.reserve(compiled.nodeIds.size());
+    compiled.choices.reserve(choiceTotal);
+
+    for (const std::string& nodeId : compiled.nodeIds) {
+        const DialogueNode& source = tree.nodes.at(nodeId);
+
+        CompiledDialogue::Node node;
+        node.speakerName = source.speakerName;
+        node.text = source.text;
+        node.firstChoice = static_cast<std::uint32_t>(compiled.choices.size());
+        node.choiceCount = static_cast<std::uint32_t>(source.choices.size());
+        node.isPlayerSpeaking = source.isPlayerSpeaking;
+        node.isEndNode = source.isEndNode;
+        compiled.nodes.push_back(std::move(node));
+
+        for (const DialogueChoice& sourceChoice : source.choices) {
+            CompiledDialogue::Choice choice;
+            choice.text = sourceChoice.text;
+            choice.id = sourceChoice.id.isValid() ? sourceChoice.id : StringId(sourceChoice.text);
+
+            if (!sourceChoice.nextNodeId.empty()) {
+                auto it = indices.find(sourceChoice.nextNodeId);
+                if (it == indices.end()) {
+                    std::cerr << "Unknown next node '" << sourceChoice.nextNodeId
+                              << "' in dialogue: " << tree.id << std::endl;
+                    return false;
+                }
+                choice.nextNode = it->second;
+            }
+
+
+            choice.firstCondition = static_cast<std::uint32_t>(compiled.ops.size());
+            if (sourceChoice.requiresMoney) {
+                compiled.ops.push_back(DialogueOp::requireMoney(sourceChoice.moneyCost));
+            }
+            if (sourceChoice.requiresItem) {
+                compiled.ops.push_back(DialogueOp::requireItem(StringId(sourceChoice.requiredItemId)));
+            }
+            compiled.ops.insert(compiled.ops.end(), sourceChoice.conditions.begin(), sourceChoice.conditions.end());
+            choice.conditionCount = static_cast<std::uint32_t>(compiled.ops.size()) - choice.firstCondition;
+
+            choice.firstEffect = static_cast<std::uint32_t>(compiled.ops.size());
+            if (sourceChoice.requiresMoney && sourceChoice.moneyCost > 0.0f) {
+                compiled.ops.push_back(DialogueOp::spendMoney(sourceChoice.moneyCost));
+            }
+            compiled.ops.insert(compiled.ops.end(), sourceChoice.effects.begin(), sourceChoice.effects.end());
+            choice.effectCount = static_cast<std::uint32_t>(compiled.ops.size()) - choice.firstEffect;
+
+            compiled.choices.push_back(std::move(choice));
+        }
+    }
+
+    return true;
+}
+
+
 
 
 
 DialogueManager* DialogueManager::s_instance = nullptr;
 
 DialogueManager::DialogueManager()
-    : m_active(false) {
+    : m_currentNode(CompiledDialogue::END_NODE),
+      m_active(false),
+      m_playerState(nullptr) {
 }
 
 DialogueManager& DialogueManager::getInstance() {
@@ -19,8 +131,23 @@ DialogueManager& DialogueManager::getInstance() {
     return *s_instance;
 }
 
-void DialogueManager::registerDialogue(const std::string& id, const DialogueTree& tree) {
-    m_dialogues[id] = tree;
+bool DialogueManager::registerDialogue(const std::string& id, const DialogueTree& tree) {
+    std::size_t internErrors = StringId::getInternErrorCount();
+    auto compiled = std::make_shared<CompiledDialogue>();
+    if (!compileDialogue(tree, *compiled) || StringId::getInternErrorCount() != internErrors) {
+        std::cerr << "Failed to compile dialogue: " << id << std::endl;
+        return false;
+    }
+
+    registerDialogue(id, std::move(compiled));
+    return true;
+}
+
+void DialogueManager::registerDialogue(const std::string& id, std::shared_ptr<const CompiledDialogue> dialogue) {
+    if (!dialogue) {
+        return;
+    }
+    m_dialogues[id] = std::move(dialogue);
 }
 
 void DialogueManager::removeDialogue(const std::string& id) {
@@ -40,16 +167,16 @@ bool DialogueManager::startDialogue(const std::string& dialogueId) {
     }
 
 
-    const DialogueTree& tree = it->second;
-    auto nodeIt = tree.nodes.find(tree.startNodeId);
-    if (nodeIt == tree.nodes.end()) {
+    const CompiledDialogue& dialogue = *it->second;
+    if (dialogue.startNode < 0 || dialogue.startNode >= static_cast<int>(dialogue.nodes.size())) {
         std::cerr << "Start node not found in dialogue: " << dialogueId << std::endl;
         return false;
     }
 
 
+    m_current = it->second;
     m_currentDialogueId = dialogueId;
-    m_currentNodeId = tree.startNodeId;
+    m_currentNode = dialogue.startNode;
     m_active = true;
 
     return true;
@@ -60,61 +187,56 @@ void DialogueManager::selectChoice(int choiceIndex) {
         return;
     }
 
-    const DialogueNode* currentNode = getCurrentNode();
-    if (!currentNode) {
-        return;
-    }
 
 
-    if (choiceIndex < 0 || choiceIndex >= static_cast<int>(currentNode->choices.size())) {
+    std::shared_ptr<const CompiledDialogue> dialogue = m_current;
+    const CompiledDialogue::Choice* choice = getChoice(choiceIndex);
+    if (!choice) {
         std::cerr << "Invalid choice index: " << choiceIndex << std::endl;
         return;
     }
 
-    const DialogueChoice& choice = currentNode->choices[choiceIndex];
-
 
-    if (!isChoiceAvailable(choiceIndex)) {
+    if (findFailedCondition(*choice)) {
         std::cerr << "Choice not available: " << getChoiceUnavailableReason(choiceIndex) << std::endl;
         return;
     }
 
 
-    if (choice.consequence.execute) {
-        choice.consequence.execute();
+    for (std::uint32_t i = 0; i < choice->effectCount; i++) {
+        applyEffect(dialogue->ops[choice->firstEffect + i]);
     }
 
 
-    addToHistory(m_currentDialogueId, choice.text);
+    addToHistory(StringId(m_currentDialogueId), choice->id);
 
 
-    if (choice.nextNodeId.empty()) {
+    if (choice->nextNode == CompiledDialogue::END_NODE) {
 
         endDialogue();
-    } else {
-        if (!goToNode(choice.nextNodeId)) {
+    } else if (!goToNode(choice->nextNode)) {
 
-            std::cerr << "Next node not found: " << choice.nextNodeId << std::endl;
-            endDialogue();
-        }
+        std::cerr << "Next node not found: " << choice->nextNode << std::endl;
+        endDialogue();
     }
 }
 
 bool DialogueManager::goToNode(const std::string& nodeId) {
-    const DialogueTree* tree = getCurrentTree();
-    if (!tree) {
+    if (!m_current) {
         return false;
     }
+    return goToNode(m_current->findNode(nodeId));
+}
 
-    auto nodeIt = tree->nodes.find(nodeId);
-    if (nodeIt == tree->nodes.end()) {
+bool DialogueManager::goToNode(int nodeIndex) {
+    if (!m_current || nodeIndex < 0 || nodeIndex >= static_cast<int>(m_current->nodes.size())) {
         return false;
     }
 
-    m_currentNodeId = nodeId;
+    m_currentNode = nodeIndex;
 
 
-    if (nodeIt->second.isEndNode) {
+    if (m_current->nodes[nodeIndex].isEndNode) {
         endDialogue();
     }
 
@@ -123,109 +245,157 @@ bool DialogueManager::goToNode(const std::string& nodeId) {
 
 void DialogueManager::endDialogue() {
     m_active = false;
+    m_current.reset();
     m_currentDialogueId.clear();
-    m_currentNodeId.clear();
+    m_currentNode = CompiledDialogue::END_NODE;
 }
 
-const DialogueNode* DialogueManager::getCurrentNode() const {
-    if (!m_active) {
+const CompiledDialogue::Node* DialogueManager::getCurrentNode() const {
+    if (!m_active || !m_current) {
         return nullptr;
     }
 
-    const DialogueTree* tree = getCurrentTree();
-    if (!tree) {
+    if (m_currentNode < 0 || m_currentNode >= static_cast<int>(m_current->nodes.size())) {
         return nullptr;
     }
 
-    auto it = tree->nodes.find(m_currentNodeId);
-    if (it == tree->nodes.end()) {
-        return nullptr;
-    }
-
-    return &(it->second);
+    return &m_current->nodes[m_currentNode];
 }
 
-const DialogueTree* DialogueManager::getCurrentTree() const {
-    if (m_currentDialogueId.empty()) {
-        return nullptr;
-    }
-
-    auto it = m_dialogues.find(m_currentDialogueId);
-    if (it == m_dialogues.end()) {
+const CompiledDialogue::Choice* DialogueManager::getChoice(int choiceIndex) const {
+    const CompiledDialogue::Node* currentNode = getCurrentNode();
+    if (!currentNode) {
         return nullptr;
     }
-
-    return &(it->second);
+    return m_current->getChoice(*currentNode, choiceIndex);
 }
 
 bool DialogueManager::isChoiceAvailable(int choiceIndex) const {
-    const DialogueNode* currentNode = getCurrentNode();
-    if (!currentNode) {
-        return false;
-    }
-
-    if (choiceIndex < 0 || choiceIndex >= static_cast<int>(currentNode->choices.size())) {
-        return false;
-    }
-
-    const DialogueChoice& choice = currentNode->choices[choiceIndex];
-
-
-    if (choice.condition.check && !choice.condition.check()) {
-        return false;
-    }
-
-    return true;
+    const CompiledDialogue::Choice* choice = getChoice(choiceIndex);
+    return choice && !findFailedCondition(*choice);
 }
 
 std::string DialogueManager::getChoiceUnavailableReason(int choiceIndex) const {
-    const DialogueNode* currentNode = getCurrentNode();
-    if (!currentNode) {
+    if (!getCurrentNode()) {
         return "No active dialogue";
     }
 
-    if (choiceIndex < 0 || choiceIndex >= static_cast<int>(currentNode->choices.size())) {
+    const CompiledDialogue::Choice* choice = getChoice(choiceIndex);
+    if (!choice) {
         return "Invalid choice index";
     }
 
-    const DialogueChoice& choice = currentNode->choices[choiceIndex];
+    const DialogueOp* failed = findFailedCondition(*choice);
+    if (!failed) {
+        return "Доступно / Available";
+    }
 
+    switch (failed->code) {
+    case DialogueOpCode::REQUIRE_MONEY: {
+        std::string amount = std::to_string(static_cast<int>(failed->value));
+        return "Недостаточно денег ($" + amount + ") / Not enough money ($" + amount + ")";
+    }
+    case DialogueOpCode::REQUIRE_ITEM:
+        return "Нужен предмет: " + failed->target.str() +
+               " / Requires item: " + failed->target.str();
+    case DialogueOpCode::REQUIRE_RELATIONSHIP:
+        return "Недостаточно доверия / Relationship too low";
+    default:
+        return "Требования не выполнены / Requirements not met";
+    }
+}
 
-    if (choice.condition.check && !choice.condition.check()) {
-        if (!choice.condition.description.empty()) {
-            return "Недоступно: " + choice.condition.description +
-                   " / Unavailable: " + choice.condition.description;
+const DialogueOp* DialogueManager::findFailedCondition(const CompiledDialogue::Choice& choice) const {
+    for (std::uint32_t i = 0; i < choice.conditionCount; i++) {
+        const DialogueOp& op = m_current->ops[choice.firstCondition + i];
+        if (!checkCondition(op)) {
+            return &op;
         }
-        return "Требования не выполнены / Requirements not met";
     }
+    return nullptr;
+}
 
-    return "Доступно / Available";
+bool DialogueManager::checkCondition(const DialogueOp& op) const {
+    switch (op.code) {
+    case DialogueOpCode::REQUIRE_MONEY:
+        return m_playerState && m_playerState->canAfford(op.value);
+    case DialogueOpCode::REQUIRE_ITEM:
+        return m_playerState &&
+               m_playerState->getInventory().hasItem(op.target, static_cast<int>(op.value));
+    case DialogueOpCode::REQUIRE_FLAG:
+        return hasFlag(op.target);
+    case DialogueOpCode::REQUIRE_NOT_FLAG:
+        return !hasFlag(op.target);
+    case DialogueOpCode::REQUIRE_RELATIONSHIP: {
+        const NPC* npc = NPCManager::getInstance().getNPC(op.target.str());
+        return npc && npc->getRelationship() >= static_cast<int>(op.value);
+    }
+    default:
+        return true;
+    }
+}
+
+void DialogueManager::applyEffect(const DialogueOp& op) {
+    switch (op.code) {
+    case DialogueOpCode::SPEND_MONEY:
+        if (m_playerState) {
+            m_playerState->addMoney(-op.value);
+        }
+        break;
+    case DialogueOpCode::ADD_MONEY:
+        if (m_playerState) {
+            m_playerState->addMoney(op.value);
+        }
+        break;
+    case DialogueOpCode::REMOVE_ITEM:
+        if (m_playerState) {
+            m_playerState->getInventory().removeItemByName(op.target, static_cast<int>(op.value));
+        }
+        break;
+    case DialogueOpCode::MODIFY_RELATIONSHIP:
+        if (NPC* npc = NPCManager::getInstance().getNPC(op.target.str())) {
+            npc->modifyRelationship(static_cast<int>(op.value));
+        }
+        break;
+    case DialogueOpCode::SET_FLAG:
+        setFlag(op.target);
+        break;
+    default:
+        break;
+    }
 }
 
-void DialogueManager::addToHistory(const std::string& dialogueId, const std::string& choiceId) {
-    m_history[dialogueId].push_back(choiceId);
+void DialogueManager::setFlag(StringId flag) {
+    if (!flag.isValid() || m_flagSet.has(flag)) {
+        return;
+    }
+    m_flagSet.add(flag);
+    m_flags.push_back(flag);
 }
 
-bool DialogueManager::wasChoiceMade(const std::string& dialogueId, const std::string& choiceId) const {
-    auto it = m_history.find(dialogueId);
-    if (it == m_history.end()) {
-        return false;
+void DialogueManager::addToHistory(StringId dialogueId, StringId choiceId) {
+    if (!choiceId.isValid()) {
+        return;
     }
+    if (m_madeChoices.insert(makeChoiceKey(dialogueId, choiceId)).second) {
+        m_history[dialogueId].push_back(choiceId);
+    }
+}
 
-    const auto& choices = it->second;
-    return std::find(choices.begin(), choices.end(), choiceId) != choices.end();
+bool DialogueManager::wasChoiceMade(StringId dialogueId, StringId choiceId) const {
+    return m_madeChoices.count(makeChoiceKey(dialogueId, choiceId)) != 0;
 }
 
 void DialogueManager::clearHistory() {
     m_history.clear();
+    m_madeChoices.clear();
 }
 
 void DialogueManager::clear() {
     m_dialogues.clear();
-    m_history.clear();
-    m_active = false;
-    m_currentDialogueId.clear();
-    m_currentNodeId.clear();
+    clearHistory();
+    clearFlags();
+    endDialogue();
 }
 
 
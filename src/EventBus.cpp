@@ -0,0 +1,91 @@
+#include "EventBus.h"
+
+
+std::size_t EventBusDetail::nextTypeIndex() {
+    static std::atomic<std::size_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+EventBus& EventBus::getInstance() {
+    static EventBus instance;
+    return instance;
+}
+
+EventBus::EventBus()
+    : m_queueHead(&m_queueStub),
+      m_queueTail(&m_queueStub),
+      m_nextListenerId(1) {
+}
+
+EventBus::~EventBus() {
+    while (QueueNode* node = popNode()) {
+        delete node;
+    }
+}
+
+
+
+void EventBus::pushNode(QueueNode* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    QueueNode* previous = m_queueHead.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+
+
+
+EventBus::QueueNode* EventBus::popNode() {
+    QueueNode* tail = m_queueTail;
+    QueueNode* next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &m_queueStub) {
+        if (!next) {
+            return nullptr;
+        }
+        m_queueTail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        m_queueTail = next;
+        return tail;
+    }
+
+    if (tail != m_queueHead.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    pushNode(&m_queueStub);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        m_queueTail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void EventBus::processQueue() {
+
+
+    m_batch.clear();
+    while (QueueNode* node = popNode()) {
+        m_batch.push_back(node);
+    }
+
+    for (QueueNode* node : m_batch) {
+        node->dispatch(*this);
+        delete node;
+    }
+    m_batch.clear();
+}
+
+void EventBus::clearAllSubscribers() {
+    for (auto& channel : m_channels) {
+        if (channel) {
+            channel->clear();
+        }
+    }
+}
@@ -2,88 +2,264 @@
 #include "GameStateManager.h"
 #include "NPC.h"
 #include "PlayerState.h"
+#include "Profiler.h"
 #include <algorithm>
-#include <random>
-#include <ctime>
 
 
-EventManager::EventManager() {
+namespace {
 
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
+std::uint64_t makeBucketKey(StringId location, StringId roadType) {
+    return (static_cast<std::uint64_t>(location.getHash()) << 32) | roadType.getHash();
 }
 
 
-void EventManager::addEvent(const GameEvent& event) {
-    m_events.push_back(event);
+template<typename T>
+std::uint32_t countAtOrBelow(const std::vector<T>& thresholds, T value) {
+    return static_cast<std::uint32_t>(std::upper_bound(thresholds.begin(), thresholds.end(), value) -
+                                      thresholds.begin());
+}
+
+template<typename T>
+std::uint32_t countBelow(const std::vector<T>& thresholds, T value) {
+    return static_cast<std::uint32_t>(std::lower_bound(thresholds.begin(), thresholds.end(), value) -
+                                      thresholds.begin());
+}
+
+}
+
+
+EventManager::EventManager()
+    : m_catalog(std::make_shared<EventCatalog>()),
+      m_random(&RandomService::getInstance().getStream(RandomStreamId::EVENTS)),
+      m_outcomeRandom(&RandomService::getInstance().getStream(RandomStreamId::EVENT_OUTCOMES)),
+      m_eligibilityDirty(true),
+      m_npcCacheValid(false),
+      m_teamRevision(0),
+      m_relationshipRevision(0) {
+}
+
+
+void EventManager::setRandomStreams(RandomStream& eventStream, RandomStream& outcomeStream) {
+    m_random = &eventStream;
+    m_outcomeRandom = &outcomeStream;
+}
+
+
+
+
+EventManager::EventCatalog& EventManager::editCatalog() {
+    if (m_catalog.use_count() > 1) {
+        m_catalog = std::make_shared<EventCatalog>(*m_catalog);
+    }
+    m_catalog->indexed = false;
+    m_eligibilityDirty = true;
+    return *m_catalog;
 }
 
 
-void EventManager::removeEvent(const std::string& id) {
-    m_events.erase(
-        std::remove_if(m_events.begin(), m_events.end(),
-            [&id](const GameEvent& event) { return event.id == id; }),
-        m_events.end()
-    );
+void EventManager::addEvent(const GameEvent& event) {
+    EventCatalog& catalog = editCatalog();
+    catalog.eventIndex.emplace(StringId(event.id), catalog.events.size());
+    catalog.events.push_back(event);
 }
 
 
-GameEvent* EventManager::getEvent(const std::string& id) {
-    for (auto& event : m_events) {
-        if (event.id == id) {
-            return &event;
+void EventManager::removeEvent(StringId id) {
+    if (m_catalog->eventIndex.count(id) == 0) {
+        return;
+    }
+
+    EventCatalog& catalog = editCatalog();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < catalog.events.size(); i++) {
+        if (StringId(catalog.events[i].id) == id) {
+            continue;
+        }
+        if (kept != i) {
+            catalog.events[kept] = std::move(catalog.events[i]);
+            if (i < m_triggered.size()) {
+                m_triggered[kept] = m_triggered[i];
+            }
         }
+        kept++;
     }
-    return nullptr;
+    catalog.events.resize(kept);
+    if (m_triggered.size() > kept) {
+        m_triggered.resize(kept);
+    }
+    catalog.rebuildEventIndex();
 }
 
 
-const std::vector<GameEvent>& EventManager::getAllEvents() const {
-    return m_events;
+const GameEvent* EventManager::getEvent(StringId id) const {
+    auto it = m_catalog->eventIndex.find(id);
+    return it != m_catalog->eventIndex.end() ? &m_catalog->events[it->second] : nullptr;
 }
 
 
-bool EventManager::checkCondition(const EventCondition& condition,
-                                 float fuel, float energy, int money,
-                                 const std::string& location,
-                                 const std::string& roadType) const {
+void EventManager::EventCatalog::rebuildEventIndex() {
+    eventIndex.clear();
+    for (std::size_t i = 0; i < events.size(); i++) {
+        eventIndex.emplace(StringId(events[i].id), i);
+    }
+}
 
-    if (fuel < condition.minFuel || fuel > condition.maxFuel) {
-        return false;
+
+const std::vector<GameEvent>& EventManager::getAllEvents() const {
+    return m_catalog->events;
+}
+
+
+void EventManager::buildIndex() {
+    if (!m_catalog->indexed) {
+        editCatalog().rebuildEligibilityIndex();
+        m_catalog->indexed = true;
     }
+}
 
 
-    if (energy < condition.minEnergy || energy > condition.maxEnergy) {
-        return false;
+void EventManager::EventCatalog::rebuildEligibilityIndex() {
+    gates.clear();
+    buckets.clear();
+    blockedBy.clear();
+    gates.reserve(events.size());
+
+    minFuelThresholds.clear();
+    maxFuelThresholds.clear();
+    minEnergyThresholds.clear();
+    maxEnergyThresholds.clear();
+    minMoneyThresholds.clear();
+    maxMoneyThresholds.clear();
+
+    const EventCondition unconstrained;
+
+    for (std::size_t i = 0; i < events.size(); i++) {
+        const GameEvent& event = events[i];
+        const EventCondition& condition = event.condition;
+
+        EventGate gate;
+        gate.minFuel = condition.minFuel;
+        gate.maxFuel = condition.maxFuel;
+        gate.minEnergy = condition.minEnergy;
+        gate.maxEnergy = condition.maxEnergy;
+        gate.minMoney = condition.minMoney;
+        gate.maxMoney = condition.maxMoney;
+        gate.probability = condition.probability;
+        gate.weight = event.weight;
+        gate.hasPartyCondition = condition.minPartySize > unconstrained.minPartySize ||
+                                 condition.maxPartySize < unconstrained.maxPartySize ||
+                                 !condition.requiredNPCsInParty.empty();
+        gate.hasRelationshipCondition = !condition.minRelationships.empty();
+        gates.push_back(gate);
+
+        minFuelThresholds.push_back(gate.minFuel);
+        maxFuelThresholds.push_back(gate.maxFuel);
+        minEnergyThresholds.push_back(gate.minEnergy);
+        maxEnergyThresholds.push_back(gate.maxEnergy);
+        minMoneyThresholds.push_back(gate.minMoney);
+        maxMoneyThresholds.push_back(gate.maxMoney);
+
+        StringId location(condition.requiredLocation);
+        StringId roadType(condition.requiredRoadType);
+        buckets[makeBucketKey(location, roadType)].push_back(i);
+
+        for (StringId blockingEventId : condition.blockedIfTriggered) {
+            blockedBy[blockingEventId].push_back(i);
+        }
     }
 
 
-    if (money < condition.minMoney || money > condition.maxMoney) {
-        return false;
+    for (auto* thresholds : {&minFuelThresholds, &maxFuelThresholds,
+                             &minEnergyThresholds, &maxEnergyThresholds}) {
+        std::sort(thresholds->begin(), thresholds->end());
     }
+    std::sort(minMoneyThresholds.begin(), minMoneyThresholds.end());
+    std::sort(maxMoneyThresholds.begin(), maxMoneyThresholds.end());
+}
 
 
-    if (!condition.requiredLocation.empty() &&
-        condition.requiredLocation != location) {
-        return false;
+
+
+void EventManager::rebuildRunState() {
+    buildIndex();
+
+    m_blockCount.assign(m_catalog->events.size(), 0);
+    m_samplers.clear();
+    for (std::size_t i = 0; i < m_triggered.size(); i++) {
+        if (m_triggered[i]) {
+            applyTriggered(i, 1);
+        }
     }
 
+    m_npcCacheValid = false;
+    m_eligibilityDirty = false;
+}
 
-    if (!condition.requiredRoadType.empty() &&
-        condition.requiredRoadType != roadType) {
-        return false;
+
+bool EventManager::isTriggered(std::size_t eventIndex) const {
+    return eventIndex < m_triggered.size() && m_triggered[eventIndex];
+}
+
+
+bool EventManager::isTriggered(StringId id) const {
+    auto it = m_catalog->eventIndex.find(id);
+    return it != m_catalog->eventIndex.end() && isTriggered(it->second);
+}
+
+
+void EventManager::applyTriggered(std::size_t eventIndex, int delta) {
+    const EventCatalog& catalog = *m_catalog;
+    const GameEvent& event = catalog.events[eventIndex];
+    if (event.oneTimeOnly) {
+        m_blockCount[eventIndex] += delta;
+        m_samplers.clear();
     }
 
 
-    float roll = randomFloat(0.0f, 1.0f);
-    if (roll > condition.probability) {
-        return false;
+
+    StringId id(event.id);
+    auto canonical = catalog.eventIndex.find(id);
+    if (canonical == catalog.eventIndex.end() || canonical->second != eventIndex) {
+        return;
     }
 
+    auto blocked = catalog.blockedBy.find(id);
+    if (blocked != catalog.blockedBy.end()) {
+        for (std::size_t blockedIndex : blocked->second) {
+            m_blockCount[blockedIndex] += delta;
+        }
+        m_samplers.clear();
+    }
+}
 
 
+void EventManager::refreshNpcCache() {
+    const NPCManager& npcManager = NPCManager::getInstance();
+    std::uint32_t teamRevision = npcManager.getTeamRevision();
+    std::uint32_t relationshipRevision = npcManager.getRelationshipRevision();
+    if (m_npcCacheValid && teamRevision == m_teamRevision && relationshipRevision == m_relationshipRevision) {
+        return;
+    }
 
+    const EventCatalog& catalog = *m_catalog;
+    m_npcEligible.assign(catalog.events.size(), true);
+    for (std::size_t i = 0; i < catalog.events.size(); i++) {
+        const EventGate& gate = catalog.gates[i];
+        if (gate.hasPartyCondition && !checkPartyCondition(catalog.events[i].condition)) {
+            m_npcEligible[i] = false;
+        } else if (gate.hasRelationshipCondition && !checkRelationshipCondition(catalog.events[i].condition)) {
+            m_npcEligible[i] = false;
+        }
+    }
+
+    m_teamRevision = teamRevision;
+    m_relationshipRevision = relationshipRevision;
+    m_npcCacheValid = true;
+    m_samplers.clear();
+}
 
 
+bool EventManager::checkPartyCondition(const EventCondition& condition) const {
     NPCManager& npcManager = NPCManager::getInstance();
     const auto& team = npcManager.getTeam();
 
@@ -101,6 +277,12 @@ bool EventManager::checkCondition(const EventCondition& condition,
         }
     }
 
+    return true;
+}
+
+
+bool EventManager::checkRelationshipCondition(const EventCondition& condition) const {
+    NPCManager& npcManager = NPCManager::getInstance();
 
     for (const auto& pair : condition.minRelationships) {
         const std::string& npcId = pair.first;
@@ -112,14 +294,63 @@ bool EventManager::checkCondition(const EventCondition& condition,
         }
     }
 
+    return true;
+}
+
+
+bool EventManager::checkCondition(const EventCondition& condition,
+                                 float fuel, float energy, int money,
+                                 const std::string& location,
+                                 const std::string& roadType) const {
+
+    if (fuel < condition.minFuel || fuel > condition.maxFuel) {
+        return false;
+    }
+
+
+    if (energy < condition.minEnergy || energy > condition.maxEnergy) {
+        return false;
+    }
+
+
+    if (money < condition.minMoney || money > condition.maxMoney) {
+        return false;
+    }
+
+
+    if (!condition.requiredLocation.empty() &&
+        condition.requiredLocation != location) {
+        return false;
+    }
+
+
+    if (!condition.requiredRoadType.empty() &&
+        condition.requiredRoadType != roadType) {
+        return false;
+    }
+
+
+    float roll = randomFloat(0.0f, 1.0f);
+    if (roll > condition.probability) {
+        return false;
+    }
+
+
+
+
+
+
+    if (!checkPartyCondition(condition) || !checkRelationshipCondition(condition)) {
+        return false;
+    }
+
 
 
 
 
     if (!condition.blockedIfTriggered.empty()) {
-        for (const std::string& blockingEventId : condition.blockedIfTriggered) {
-            GameEvent* blockingEvent = const_cast<EventManager*>(this)->getEvent(blockingEventId);
-            if (blockingEvent && blockingEvent->triggered) {
+        for (StringId blockingEventId : condition.blockedIfTriggered) {
+            if (isTriggered(blockingEventId)) {
                 return false;
             }
         }
@@ -129,78 +360,233 @@ bool EventManager::checkCondition(const EventCondition& condition,
 }
 
 
-GameEvent* EventManager::getRandomEvent(float fuel, float energy, int money,
-                                       const std::string& location,
-                                       const std::string& roadType) {
+const GameEvent* EventManager::getRandomEvent(float fuel, float energy, int money,
+                                             const std::string& location,
+                                             const std::string& roadType) {
+    ProfileZone zone("EventManager::getRandomEvent");
 
-    std::vector<GameEvent*> eligibleEvents;
+    if (m_eligibilityDirty || !m_catalog->indexed) {
+        rebuildRunState();
+    }
+    refreshNpcCache();
+    const EventCatalog& catalog = *m_catalog;
+
+
+
+    StringId locationId(location);
+    StringId roadTypeId(roadType);
+    const ResourceCell cell = findResourceCell(fuel, energy, money);
 
-    for (auto& event : m_events) {
 
-        if (event.oneTimeOnly && event.triggered) {
+
+    if (m_samplers.size() + 4 > MAX_CACHED_SAMPLERS) {
+        m_samplers.clear();
+    }
+
+    const BucketSampler* samplers[4] = {};
+    std::size_t samplerCount = 0;
+    float totalWeight = 0.0f;
+    auto addBucket = [&](StringId bucketLocation, StringId bucketRoadType) {
+        const BucketSampler* sampler = getBucketSampler(makeBucketKey(bucketLocation, bucketRoadType),
+                                                        cell, fuel, energy, money);
+        if (sampler) {
+            samplers[samplerCount++] = sampler;
+            totalWeight += sampler->totalWeight;
+        }
+    };
+
+    addBucket(StringId(), StringId());
+    if (roadTypeId.isValid()) {
+        addBucket(StringId(), roadTypeId);
+    }
+    if (locationId.isValid()) {
+        addBucket(locationId, StringId());
+        if (roadTypeId.isValid()) {
+            addBucket(locationId, roadTypeId);
+        }
+    }
+
+    if (samplerCount == 0) {
+        return nullptr;
+    }
+
+
+
+
+    std::array<std::size_t, MAX_REJECTION_ATTEMPTS> rejected;
+    std::size_t rejectedCount = 0;
+    auto wasRejected = [&](std::size_t index) {
+        return std::find(rejected.begin(), rejected.begin() + rejectedCount, index) != rejected.begin() + rejectedCount;
+    };
+
+    for (int attempt = 0; totalWeight > 0.0f && attempt < MAX_REJECTION_ATTEMPTS; attempt++) {
+        float pick = randomFloat(0.0f, totalWeight);
+        const BucketSampler* sampler = samplers[samplerCount - 1];
+        for (std::size_t i = 0; i + 1 < samplerCount; i++) {
+            if (pick < samplers[i]->totalWeight) {
+                sampler = samplers[i];
+                break;
+            }
+            pick -= samplers[i]->totalWeight;
+        }
+        if (sampler->events.empty()) {
+            continue;
+        }
+
+        float column = randomFloat(0.0f, 1.0f);
+        float coin = randomFloat(0.0f, 1.0f);
+        std::size_t index = sampler->events[sampler->table.sample(column, coin)];
+        if (wasRejected(index)) {
             continue;
         }
 
-        if (checkCondition(event.condition, fuel, energy, money, location, roadType)) {
-            eligibleEvents.push_back(&event);
+        float probability = catalog.gates[index].probability;
+        if (probability < 1.0f && randomFloat(0.0f, 1.0f) > probability) {
+            rejected[rejectedCount++] = index;
+            continue;
         }
+        return &catalog.events[index];
     }
 
 
-    if (eligibleEvents.empty()) {
+
+    std::vector<std::size_t> candidates;
+    float candidateWeight = 0.0f;
+    for (bool zeroWeight : {false, true}) {
+        if (zeroWeight && !candidates.empty()) {
+            break;
+        }
+        for (std::size_t i = 0; i < samplerCount; i++) {
+            for (std::size_t index : zeroWeight ? samplers[i]->zeroWeightEvents : samplers[i]->events) {
+                float probability = catalog.gates[index].probability;
+                if (wasRejected(index) ||
+                    (probability < 1.0f && randomFloat(0.0f, 1.0f) > probability)) {
+                    continue;
+                }
+                candidates.push_back(index);
+                candidateWeight += catalog.gates[index].weight;
+            }
+        }
+    }
+
+    if (candidates.empty()) {
         return nullptr;
     }
+    if (candidateWeight <= 0.0f) {
+        return &catalog.events[candidates[randomInt(0, static_cast<int>(candidates.size()) - 1)]];
+    }
+
+    float pick = randomFloat(0.0f, candidateWeight);
+    for (std::size_t index : candidates) {
+        pick -= catalog.gates[index].weight;
+        if (pick <= 0.0f) {
+            return &catalog.events[index];
+        }
+    }
+    return &catalog.events[candidates.back()];
+}
 
 
+std::size_t EventManager::SamplerKeyHash::operator()(const SamplerKey& key) const {
+    std::uint64_t hash = key.bucket;
+    for (std::uint32_t value : key.cell) {
+        hash = (hash ^ value) * 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
 
 
+EventManager::ResourceCell EventManager::findResourceCell(float fuel, float energy, int money) const {
 
 
-    float totalWeight = 0.0f;
-    for (const auto* event : eligibleEvents) {
-        totalWeight += event->weight;
-    }
+
+    const EventCatalog& catalog = *m_catalog;
+    return {countAtOrBelow(catalog.minFuelThresholds, fuel), countBelow(catalog.maxFuelThresholds, fuel),
+            countAtOrBelow(catalog.minEnergyThresholds, energy), countBelow(catalog.maxEnergyThresholds, energy),
+            countAtOrBelow(catalog.minMoneyThresholds, money), countBelow(catalog.maxMoneyThresholds, money)};
+}
 
 
-    if (totalWeight <= 0.0f) {
-        int randomIndex = randomInt(0, static_cast<int>(eligibleEvents.size()) - 1);
-        return eligibleEvents[randomIndex];
+const EventManager::BucketSampler* EventManager::getBucketSampler(std::uint64_t bucketKey,
+                                                                  const ResourceCell& cell,
+                                                                  float fuel, float energy, int money) {
+    const EventCatalog& catalog = *m_catalog;
+    auto bucket = catalog.buckets.find(bucketKey);
+    if (bucket == catalog.buckets.end()) {
+        return nullptr;
     }
 
+    SamplerKey key{bucketKey, cell};
+    auto cached = m_samplers.find(key);
+    if (cached != m_samplers.end()) {
+        const BucketSampler& sampler = cached->second;
+        return sampler.events.empty() && sampler.zeroWeightEvents.empty() ? nullptr : &sampler;
+    }
 
-    float randomValue = randomFloat(0.0f, totalWeight);
+    BucketSampler& sampler = m_samplers[key];
+    std::vector<float> weights;
+    for (std::size_t index : bucket->second) {
+        const EventGate& gate = catalog.gates[index];
 
+        if (m_blockCount[index] > 0) {
+            continue;
+        }
 
-    float accumulatedWeight = 0.0f;
-    for (auto* event : eligibleEvents) {
-        accumulatedWeight += event->weight;
-        if (randomValue <= accumulatedWeight) {
-            return event;
+        if (fuel < gate.minFuel || fuel > gate.maxFuel ||
+            energy < gate.minEnergy || energy > gate.maxEnergy ||
+            money < gate.minMoney || money > gate.maxMoney) {
+            continue;
         }
-    }
 
+        if ((gate.hasPartyCondition || gate.hasRelationshipCondition) && !m_npcEligible[index]) {
+            continue;
+        }
 
-    return eligibleEvents.back();
+        if (gate.weight <= 0.0f) {
+            sampler.zeroWeightEvents.push_back(index);
+            continue;
+        }
+        sampler.events.push_back(index);
+        weights.push_back(gate.weight);
+        sampler.totalWeight += gate.weight;
+    }
+
+    if (sampler.events.empty() && sampler.zeroWeightEvents.empty()) {
+        return nullptr;
+    }
+    if (!sampler.events.empty()) {
+        sampler.table.build(weights);
+    }
+    return &sampler;
 }
 
 
 void EventManager::triggerEvent(const std::string& id) {
-    GameEvent* event = getEvent(id);
-    if (event) {
-        event->triggered = true;
+    auto it = m_catalog->eventIndex.find(StringId(id));
+    if (it != m_catalog->eventIndex.end()) {
+        std::size_t eventIndex = it->second;
+        if (!isTriggered(eventIndex)) {
+            if (m_triggered.size() <= eventIndex) {
+                m_triggered.resize(m_catalog->events.size(), false);
+            }
+            m_triggered[eventIndex] = true;
+            if (!m_eligibilityDirty) {
+                applyTriggered(eventIndex, 1);
+            }
+        }
 
 
         if (m_eventCallback) {
-            m_eventCallback(*event);
+            m_eventCallback(m_catalog->events[eventIndex]);
         }
     }
 }
 
 
 void EventManager::resetTriggeredEvents() {
-    for (auto& event : m_events) {
-        event.triggered = false;
-    }
+    m_triggered.clear();
+    m_blockCount.assign(m_blockCount.size(), 0);
+    m_samplers.clear();
 }
 
 
@@ -236,6 +622,7 @@ void EventManager::applyChoice(const EventChoice& choice,
         if (npc) {
             npc->setInParty(true);
             npc->setMetBefore(true);
+            m_npcCacheValid = false;
         }
     }
 
@@ -244,6 +631,7 @@ void EventManager::applyChoice(const EventChoice& choice,
         NPC* npc = npcManager.getNPC(choice.removeNPC);
         if (npc) {
             npc->setInParty(false);
+            m_npcCacheValid = false;
         }
     }
 
@@ -259,13 +647,43 @@ void EventManager::applyChoice(const EventChoice& choice,
 }
 
 
+const RandomOutcome* EventManager::resolveRandomOutcome(const EventChoice& choice) {
+    if (choice.randomOutcomes.empty()) {
+        return nullptr;
+    }
+
+    float totalProbability = 0.0f;
+    for (const auto& outcome : choice.randomOutcomes) {
+        totalProbability += outcome.probability;
+    }
+
+    if (totalProbability <= 0.0f) {
+        int index = m_outcomeRandom->rangeInt(0, static_cast<int>(choice.randomOutcomes.size()) - 1);
+        return &choice.randomOutcomes[index];
+    }
+
+    float roll = m_outcomeRandom->range(0.0f, totalProbability);
+    float accumulated = 0.0f;
+    for (const auto& outcome : choice.randomOutcomes) {
+        accumulated += outcome.probability;
+        if (roll < accumulated) {
+            return &outcome;
+        }
+    }
+
+    return &choice.randomOutcomes.back();
+}
+
+
 void EventManager::setEventCallback(EventCallback callback) {
     m_eventCallback = callback;
 }
 
 
 void EventManager::clear() {
-    m_events.clear();
+    m_catalog = std::make_shared<EventCatalog>();
+    m_triggered.clear();
+    m_eligibilityDirty = true;
 }
 
 
@@ -1796,11 +2214,11 @@ void EventManager::addPerkChoicesToEvent(GameEvent* event, float playerFuel, flo
 
 
 float EventManager::randomFloat(float min, float max) const {
-    float random = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+    float random = m_random->nextFloat();
     return min + random * (max - min);
 }
 
 int EventManager::randomInt(int min, int max) const {
-    return min + (std::rand() % (max - min + 1));
+    return m_random->rangeInt(min, max);
 }
 
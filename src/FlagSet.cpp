@@ -0,0 +1,119 @@
+#include "FlagSet.h"
+#include <bitset>
+
+namespace {
+
+
+
+std::unordered_map<StringId, std::size_t>& localIndices() {
+    thread_local std::unordered_map<StringId, std::size_t> indices;
+    return indices;
+}
+
+}
+
+FlagRegistry& FlagRegistry::getInstance() {
+    static FlagRegistry instance;
+    return instance;
+}
+
+std::size_t FlagRegistry::getIndex(StringId flag) {
+    if (!flag.isValid()) {
+        return INVALID_INDEX;
+    }
+
+    auto& local = localIndices();
+    auto cached = local.find(flag);
+    if (cached != local.end()) {
+        return cached->second;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_indices.find(flag);
+    std::size_t index;
+    if (it != m_indices.end()) {
+        index = it->second;
+    } else {
+        index = m_indices.size();
+        m_indices.emplace(flag, index);
+    }
+    local.emplace(flag, index);
+    return index;
+}
+
+std::size_t FlagRegistry::findIndex(StringId flag) const {
+    auto& local = localIndices();
+    auto cached = local.find(flag);
+    if (cached != local.end()) {
+        return cached->second;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_indices.find(flag);
+    if (it == m_indices.end()) {
+        return INVALID_INDEX;
+    }
+    local.emplace(flag, it->second);
+    return it->second;
+}
+
+std::size_t FlagRegistry::getFlagCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_indices.size();
+}
+
+
+
+void FlagSet::add(StringId flag) {
+    std::size_t index = FlagRegistry::getInstance().getIndex(flag);
+    if (index == FlagRegistry::INVALID_INDEX) {
+        m_unsatisfiable = true;
+        return;
+    }
+
+    std::size_t word = index / 64;
+    if (word >= m_words.size()) {
+        m_words.resize(word + 1, 0);
+    }
+    m_words[word] |= std::uint64_t(1) << (index % 64);
+}
+
+bool FlagSet::has(StringId flag) const {
+    std::size_t index = FlagRegistry::getInstance().findIndex(flag);
+    if (index == FlagRegistry::INVALID_INDEX || index / 64 >= m_words.size()) {
+        return false;
+    }
+    return (m_words[index / 64] >> (index % 64)) & 1u;
+}
+
+bool FlagSet::containsAll(const FlagSet& required) const {
+    if (required.m_unsatisfiable) {
+        return false;
+    }
+    for (std::size_t i = 0; i < required.m_words.size(); i++) {
+        std::uint64_t have = i < m_words.size() ? m_words[i] : 0;
+        if ((required.m_words[i] & ~have) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FlagSet::empty() const {
+    for (std::uint64_t word : m_words) {
+        if (word != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t FlagSet::count() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : m_words) {
+        total += std::bitset<64>(word).count();
+    }
+    return total;
+}
@@ -1,11 +1,18 @@
 #include "GameStateManager.h"
+#include "QuestManager.h"
+#include "DialogueManager.h"
 #include <iostream>
 
 
 GameStateManager::GameStateManager()
     : m_currentLocationType(LocationType::UNKNOWN) {
 
+    QuestManager& questManager = QuestManager::getInstance();
+    if (!questManager.registerQuestsFromFile("assets/quests.json")) {
+        questManager.initializeDefaultQuests();
+    }
 
+    DialogueManager::getInstance().setPlayerState(&m_playerState);
 }
 
 
@@ -53,12 +60,8 @@ bool GameStateManager::loadGame() {
 void GameStateManager::autoSave() {
     std::cout << "Auto-saving game..." << std::endl;
 
-    if (!m_saveSystem.saveGame(m_playerState)) {
-        std::cerr << "Failed to auto-save game" << std::endl;
-        return;
-    }
 
-    std::cout << "Auto-save completed" << std::endl;
+    m_saveSystem.saveGameAsync(m_playerState);
 }
 
 
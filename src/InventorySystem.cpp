@@ -3,7 +3,8 @@
 
 
 InventorySystem::InventorySystem(int maxSlots, float maxWeight)
-    : m_maxSlots(maxSlots), m_maxWeight(maxWeight) {
+    : m_maxSlots(maxSlots), m_maxWeight(maxWeight),
+      m_totalWeight(0.0), m_emptySlotCount(maxSlots) {
     m_slots.resize(maxSlots);
 }
 
@@ -22,11 +23,10 @@ bool InventorySystem::addItem(const Item& item, int count) {
     if (item.isStackable) {
         int slotIndex = findStackableSlot(item);
         while (slotIndex != -1 && remaining > 0) {
-            InventorySlot& slot = m_slots[slotIndex];
-            int spaceInStack = item.maxStackSize - slot.count;
+            int spaceInStack = item.maxStackSize - m_slots[slotIndex].count;
             int toAdd = std::min(remaining, spaceInStack);
 
-            slot.count += toAdd;
+            adjustSlotCount(slotIndex, toAdd);
             remaining -= toAdd;
 
             if (remaining > 0) {
@@ -46,6 +46,7 @@ bool InventorySystem::addItem(const Item& item, int count) {
         m_slots[emptySlot].item = item;
         m_slots[emptySlot].count = toAdd;
         m_slots[emptySlot].isEmpty = false;
+        indexSlot(emptySlot);
         remaining -= toAdd;
     }
 
@@ -61,26 +62,28 @@ bool InventorySystem::removeItem(int slotIndex, int count) {
 
     if (count >= m_slots[slotIndex].count) {
 
+        unindexSlot(slotIndex);
         m_slots[slotIndex].isEmpty = true;
         m_slots[slotIndex].count = 0;
     } else {
 
-        m_slots[slotIndex].count -= count;
+        adjustSlotCount(slotIndex, -count);
     }
 
     return true;
 }
 
 
-int InventorySystem::removeItemByName(const std::string& itemName, int count) {
+int InventorySystem::removeItemByName(StringId itemName, int count) {
     int removed = 0;
 
-    for (int i = 0; i < m_maxSlots && removed < count; i++) {
-        if (!m_slots[i].isEmpty && m_slots[i].item.name == itemName) {
-            int toRemove = std::min(count - removed, m_slots[i].count);
-            removeItem(i, toRemove);
-            removed += toRemove;
-        }
+
+
+    std::vector<int> slots = findAllItems(itemName);
+    for (std::size_t i = 0; i < slots.size() && removed < count; i++) {
+        int toRemove = std::min(count - removed, m_slots[slots[i]].count);
+        removeItem(slots[i], toRemove);
+        removed += toRemove;
     }
 
     return removed;
@@ -106,37 +109,33 @@ const InventorySlot& InventorySystem::getSlot(int slotIndex) const {
 }
 
 
-InventorySlot& InventorySystem::getSlotMutable(int slotIndex) {
-    static InventorySlot emptySlot;
-    if (!isValidSlot(slotIndex)) return emptySlot;
-    return m_slots[slotIndex];
+bool InventorySystem::setSlot(int slotIndex, const Item& item, int count) {
+    if (!isValidSlot(slotIndex)) return false;
+
+    unindexSlot(slotIndex);
+    if (count > 0) {
+        m_slots[slotIndex] = InventorySlot(item, count);
+    } else {
+        m_slots[slotIndex].clear();
+    }
+    indexSlot(slotIndex);
+    return true;
 }
 
 
-bool InventorySystem::hasItem(const std::string& itemName, int minCount) const {
+bool InventorySystem::hasItem(StringId itemName, int minCount) const {
     return getItemCount(itemName) >= minCount;
 }
 
 
-int InventorySystem::getItemCount(const std::string& itemName) const {
-    int total = 0;
-    for (const auto& slot : m_slots) {
-        if (!slot.isEmpty && slot.item.name == itemName) {
-            total += slot.count;
-        }
-    }
-    return total;
+int InventorySystem::getItemCount(StringId itemName) const {
+    auto it = m_itemIndex.find(itemName);
+    return it != m_itemIndex.end() ? it->second.count : 0;
 }
 
 
 float InventorySystem::getTotalWeight() const {
-    float totalWeight = 0.0f;
-    for (const auto& slot : m_slots) {
-        if (!slot.isEmpty) {
-            totalWeight += slot.item.weight * slot.count;
-        }
-    }
-    return totalWeight;
+    return static_cast<float>(m_totalWeight);
 }
 
 
@@ -156,11 +155,7 @@ int InventorySystem::getSlotCount() const {
 
 
 int InventorySystem::getEmptySlotCount() const {
-    int count = 0;
-    for (const auto& slot : m_slots) {
-        if (slot.isEmpty) count++;
-    }
-    return count;
+    return m_emptySlotCount;
 }
 
 
@@ -177,24 +172,15 @@ bool InventorySystem::canAddItem(const Item& item, int count) const {
 }
 
 
-int InventorySystem::findItem(const std::string& itemName) const {
-    for (int i = 0; i < m_maxSlots; i++) {
-        if (!m_slots[i].isEmpty && m_slots[i].item.name == itemName) {
-            return i;
-        }
-    }
-    return -1;
+int InventorySystem::findItem(StringId itemName) const {
+    auto it = m_itemIndex.find(itemName);
+    return it != m_itemIndex.end() ? it->second.slots.front() : -1;
 }
 
 
-std::vector<int> InventorySystem::findAllItems(const std::string& itemName) const {
-    std::vector<int> indices;
-    for (int i = 0; i < m_maxSlots; i++) {
-        if (!m_slots[i].isEmpty && m_slots[i].item.name == itemName) {
-            indices.push_back(i);
-        }
-    }
-    return indices;
+std::vector<int> InventorySystem::findAllItems(StringId itemName) const {
+    auto it = m_itemIndex.find(itemName);
+    return it != m_itemIndex.end() ? it->second.slots : std::vector<int>();
 }
 
 
@@ -231,6 +217,7 @@ void InventorySystem::compactInventory() {
     for (size_t i = 0; i < nonEmptySlots.size() && i < static_cast<size_t>(m_maxSlots); i++) {
         m_slots[i] = nonEmptySlots[i];
     }
+    rebuildIndex();
 }
 
 
@@ -239,6 +226,9 @@ void InventorySystem::clear() {
         slot.isEmpty = true;
         slot.count = 0;
     }
+    m_itemIndex.clear();
+    m_totalWeight = 0.0;
+    m_emptySlotCount = m_maxSlots;
 }
 
 
@@ -247,7 +237,15 @@ bool InventorySystem::swapSlots(int slotIndex1, int slotIndex2) {
         return false;
     }
 
+    if (slotIndex1 == slotIndex2) {
+        return true;
+    }
+
+    unindexSlot(slotIndex1);
+    unindexSlot(slotIndex2);
     std::swap(m_slots[slotIndex1], m_slots[slotIndex2]);
+    indexSlot(slotIndex1);
+    indexSlot(slotIndex2);
     return true;
 }
 
@@ -270,11 +268,12 @@ int InventorySystem::findEmptySlot() const {
 int InventorySystem::findStackableSlot(const Item& item) const {
     if (!item.isStackable) return -1;
 
-    for (int i = 0; i < m_maxSlots; i++) {
-        if (!m_slots[i].isEmpty &&
-            m_slots[i].item.name == item.name &&
-            m_slots[i].count < item.maxStackSize) {
-            return i;
+    auto it = m_itemIndex.find(item.nameId);
+    if (it == m_itemIndex.end()) return -1;
+
+    for (int slotIndex : it->second.slots) {
+        if (m_slots[slotIndex].count < item.maxStackSize) {
+            return slotIndex;
         }
     }
     return -1;
@@ -284,3 +283,62 @@ int InventorySystem::findStackableSlot(const Item& item) const {
 bool InventorySystem::isValidSlot(int slotIndex) const {
     return slotIndex >= 0 && slotIndex < m_maxSlots;
 }
+
+
+
+void InventorySystem::indexSlot(int slotIndex) {
+    const InventorySlot& slot = m_slots[slotIndex];
+    if (slot.isEmpty) return;
+
+    m_emptySlotCount--;
+    m_totalWeight += static_cast<double>(slot.item.weight) * slot.count;
+
+    ItemIndexEntry& entry = m_itemIndex[slot.item.nameId];
+    entry.count += slot.count;
+    entry.slots.insert(std::lower_bound(entry.slots.begin(), entry.slots.end(), slotIndex), slotIndex);
+}
+
+
+void InventorySystem::unindexSlot(int slotIndex) {
+    const InventorySlot& slot = m_slots[slotIndex];
+    if (slot.isEmpty) return;
+
+    m_emptySlotCount++;
+    m_totalWeight -= static_cast<double>(slot.item.weight) * slot.count;
+
+
+    if (m_emptySlotCount == m_maxSlots) {
+        m_totalWeight = 0.0;
+    }
+
+    auto it = m_itemIndex.find(slot.item.nameId);
+    if (it == m_itemIndex.end()) return;
+
+    ItemIndexEntry& entry = it->second;
+    entry.count -= slot.count;
+    auto position = std::lower_bound(entry.slots.begin(), entry.slots.end(), slotIndex);
+    if (position != entry.slots.end() && *position == slotIndex) {
+        entry.slots.erase(position);
+    }
+    if (entry.slots.empty()) {
+        m_itemIndex.erase(it);
+    }
+}
+
+
+void InventorySystem::adjustSlotCount(int slotIndex, int delta) {
+    InventorySlot& slot = m_slots[slotIndex];
+    slot.count += delta;
+    m_totalWeight += static_cast<double>(slot.item.weight) * delta;
+    m_itemIndex[slot.item.nameId].count += delta;
+}
+
+
+void InventorySystem::rebuildIndex() {
+    m_itemIndex.clear();
+    m_totalWeight = 0.0;
+    m_emptySlotCount = m_maxSlots;
+    for (int i = 0; i < m_maxSlots; i++) {
+        indexSlot(i);
+    }
+}
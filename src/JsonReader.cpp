@@ -0,0 +1,349 @@
+#include "JsonReader.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+
+JsonReader::JsonReader()
+    : m_pos(0),
+      m_line(1),
+      m_handler(nullptr) {
+}
+
+bool JsonReader::parse(std::string_view text, JsonHandler& handler) {
+    m_text = text;
+    m_pos = 0;
+    m_line = 1;
+    m_handler = &handler;
+    m_error.clear();
+
+
+    if (m_text.substr(0, 3) == "\xEF\xBB\xBF") {
+        m_pos = 3;
+    }
+
+    skipWhitespace();
+    if (!parseValue(0)) {
+        return false;
+    }
+
+    skipWhitespace();
+    if (m_pos != m_text.size()) {
+        return fail("Unexpected data after the top-level value");
+    }
+    return true;
+}
+
+bool JsonReader::parseFile(const std::string& path, JsonHandler& handler) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        m_line = 0;
+        m_error = "Cannot open " + path;
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+    return parse(text, handler);
+}
+
+bool JsonReader::parseValue(int depth) {
+    if (depth >= MAX_DEPTH) {
+        return fail("Nesting too deep");
+    }
+    if (m_pos >= m_text.size()) {
+        return fail("Unexpected end of input");
+    }
+
+    switch (m_text[m_pos]) {
+    case '{':
+        return parseObject(depth + 1);
+    case '[':
+        return parseArray(depth + 1);
+    case '"': {
+        std::string_view value;
+        if (!parseString(value)) {
+            return false;
+        }
+        return m_handler->string(value) || handlerStopped();
+    }
+    case 't':
+        return parseLiteral("true") && (m_handler->boolean(true) || handlerStopped());
+    case 'f':
+        return parseLiteral("false") && (m_handler->boolean(false) || handlerStopped());
+    case 'n':
+        return parseLiteral("null") && (m_handler->null() || handlerStopped());
+    default:
+        return parseNumber();
+    }
+}
+
+bool JsonReader::parseObject(int depth) {
+    m_pos++;
+    if (!m_handler->startObject()) {
+        return handlerStopped();
+    }
+
+    skipWhitespace();
+    if (m_pos < m_text.size() && m_text[m_pos] == '}') {
+        m_pos++;
+        return m_handler->endObject() || handlerStopped();
+    }
+
+    while (true) {
+        skipWhitespace();
+        if (m_pos >= m_text.size() || m_text[m_pos] != '"') {
+            return fail("Expected a string key");
+        }
+
+        std::string_view name;
+        if (!parseString(name)) {
+            return false;
+        }
+        if (!m_handler->key(name)) {
+            return handlerStopped();
+        }
+
+        skipWhitespace();
+        if (m_pos >= m_text.size() || m_text[m_pos] != ':') {
+            return fail("Expected ':' after key");
+        }
+        m_pos++;
+
+        skipWhitespace();
+        if (!parseValue(depth)) {
+            return false;
+        }
+
+        skipWhitespace();
+        if (m_pos < m_text.size() && m_text[m_pos] == ',') {
+            m_pos++;
+            continue;
+        }
+        if (m_pos < m_text.size() && m_text[m_pos] == '}') {
+            m_pos++;
+            return m_handler->endObject() || handlerStopped();
+        }
+        return fail("Expected ',' or '}' in object");
+    }
+}
+
+bool JsonReader::parseArray(int depth) {
+    m_pos++;
+    if (!m_handler->startArray()) {
+        return handlerStopped();
+    }
+
+    skipWhitespace();
+    if (m_pos < m_text.size() && m_text[m_pos] == ']') {
+        m_pos++;
+        return m_handler->endArray() || handlerStopped();
+    }
+
+    while (true) {
+        skipWhitespace();
+        if (!parseValue(depth)) {
+            return false;
+        }
+
+        skipWhitespace();
+        if (m_pos < m_text.size() && m_text[m_pos] == ',') {
+            m_pos++;
+            continue;
+        }
+        if (m_pos < m_text.size() && m_text[m_pos] == ']') {
+            m_pos++;
+            return m_handler->endArray() || handlerStopped();
+        }
+        return fail("Expected ',' or ']' in array");
+    }
+}
+
+bool JsonReader::parseString(std::string_view& value) {
+    std::size_t start = ++m_pos;
+
+
+
+    while (m_pos < m_text.size()) {
+        char c = m_text[m_pos];
+        if (c == '"') {
+            value = m_text.substr(start, m_pos - start);
+            m_pos++;
+            return true;
+        }
+        if (c == '\\') {
+            break;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            return fail("Control character in string");
+        }
+        m_pos++;
+    }
+
+    m_scratch.assign(m_text.data() + start, m_pos - start);
+    while (m_pos < m_text.size()) {
+        char c = m_text[m_pos++];
+        if (c == '"') {
+            value = m_scratch;
+            return true;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            return fail("Control character in string");
+        }
+        if (c != '\\') {
+            m_scratch.push_back(c);
+            continue;
+        }
+
+        if (m_pos >= m_text.size()) {
+            break;
+        }
+        char escape = m_text[m_pos++];
+        switch (escape) {
+        case '"': m_scratch.push_back('"'); break;
+        case '\\': m_scratch.push_back('\\'); break;
+        case '/': m_scratch.push_back('/'); break;
+        case 'b': m_scratch.push_back('\b'); break;
+        case 'f': m_scratch.push_back('\f'); break;
+        case 'n': m_scratch.push_back('\n'); break;
+        case 'r': m_scratch.push_back('\r'); break;
+        case 't': m_scratch.push_back('\t'); break;
+        case 'u': {
+            unsigned long codepoint = 0;
+            if (!readHex4(codepoint)) {
+                return false;
+            }
+
+            if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                unsigned long low = 0;
+                if (m_text.substr(m_pos, 2) != "\\u") {
+                    return fail("Unpaired surrogate in string");
+                }
+                m_pos += 2;
+                if (!readHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                    return fail("Invalid surrogate pair in string");
+                }
+                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            if (!appendCodepoint(codepoint)) {
+                return false;
+            }
+            break;
+        }
+        default:
+            return fail("Invalid escape sequence");
+        }
+    }
+
+    return fail("Unterminated string");
+}
+
+bool JsonReader::readHex4(unsigned long& value) {
+    if (m_text.size() - m_pos < 4) {
+        return fail("Truncated \\u escape");
+    }
+
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = m_text[m_pos++];
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= static_cast<unsigned long>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= static_cast<unsigned long>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value |= static_cast<unsigned long>(c - 'A' + 10);
+        } else {
+            return fail("Invalid hex digit in \\u escape");
+        }
+    }
+    return true;
+}
+
+bool JsonReader::appendCodepoint(unsigned long codepoint) {
+    if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+        return fail("Unpaired surrogate in string");
+    }
+
+    if (codepoint < 0x80) {
+        m_scratch.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+        m_scratch.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+        m_scratch.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+        m_scratch.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+        m_scratch.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        m_scratch.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+        m_scratch.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+        m_scratch.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+        m_scratch.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        m_scratch.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+    return true;
+}
+
+bool JsonReader::parseNumber() {
+    std::size_t start = m_pos;
+    if (m_pos < m_text.size() && m_text[m_pos] == '-') {
+        m_pos++;
+    }
+    while (m_pos < m_text.size()) {
+        char c = m_text[m_pos];
+        if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+            m_pos++;
+        } else {
+            break;
+        }
+    }
+
+    std::size_t length = m_pos - start;
+    if (length == 0 || length > 63) {
+        return fail(length == 0 ? "Unexpected character" : "Number too long");
+    }
+
+
+
+    char buffer[64];
+    m_text.copy(buffer, length, start);
+    buffer[length] = '\0';
+
+    char* end = nullptr;
+    double value = std::strtod(buffer, &end);
+    if (end != buffer + length) {
+        return fail("Malformed number");
+    }
+    return m_handler->number(value) || handlerStopped();
+}
+
+bool JsonReader::parseLiteral(std::string_view literal) {
+    if (m_text.substr(m_pos, literal.size()) != literal) {
+        return fail("Unexpected character");
+    }
+    m_pos += literal.size();
+    return true;
+}
+
+void JsonReader::skipWhitespace() {
+    while (m_pos < m_text.size()) {
+        char c = m_text[m_pos];
+        if (c == '\n') {
+            m_line++;
+        } else if (c != ' ' && c != '\t' && c != '\r') {
+            return;
+        }
+        m_pos++;
+    }
+}
+
+bool JsonReader::fail(const char* message) {
+    if (m_error.empty()) {
+        m_error = message;
+    }
+    return false;
+}
+
+bool JsonReader::handlerStopped() {
+    return fail("Parsing stopped by handler");
+}
@@ -91,7 +91,11 @@ bool NPC::hasQuest(const std::string& questId) const {
 
 void NPC::setRelationship(int value) {
 
-    m_relationship = std::max(-100, std::min(100, value));
+    int clamped = std::max(-100, std::min(100, value));
+    if (clamped != m_relationship) {
+        m_relationship = clamped;
+        NPCManager::getInstance().notifyRelationshipChanged();
+    }
 }
 
 void NPC::modifyRelationship(int delta) {
@@ -105,7 +109,9 @@ void NPC::modifyRelationship(int delta) {
 NPCManager* NPCManager::s_instance = nullptr;
 
 NPCManager::NPCManager()
-    : m_maxTeamSize(3) {
+    : m_maxTeamSize(3),
+      m_teamRevision(0),
+      m_relationshipRevision(0) {
 }
 
 NPCManager& NPCManager::getInstance() {
@@ -132,6 +138,7 @@ bool NPCManager::addNPC(std::unique_ptr<NPC> npc) {
     }
 
     m_team.push_back(std::move(npc));
+    m_teamRevision++;
     return true;
 }
 
@@ -143,6 +150,7 @@ void NPCManager::removeNPC(const std::string& npcId) {
             }),
         m_team.end()
     );
+    m_teamRevision++;
 }
 
 NPC* NPCManager::getNPC(const std::string& npcId) {
@@ -166,6 +174,7 @@ void NPCManager::addExperienceToTeam(int exp) {
 
 void NPCManager::clear() {
     m_team.clear();
+    m_teamRevision++;
 }
 
 
@@ -10,34 +10,16 @@ bool NotebookChoice::isAvailable(const PlayerState* player) const {
     }
 
     if (!player) {
-        bool hasConditionalRequirements = !requiredPrinciples.empty() ||
-                                          !requiredTraits.empty() ||
-                                          !requiredStoryItems.empty();
+        bool hasConditionalRequirements = !m_requiredPrinciples.empty() ||
+                                          !m_requiredTraits.empty() ||
+                                          !m_requiredStoryItems.empty();
         return !(isHidden || hasConditionalRequirements);
     }
 
-    bool hasConditionalRequirements = !requiredPrinciples.empty() ||
-                                      !requiredTraits.empty() ||
-                                      !requiredStoryItems.empty();
-
-    if (isHidden || hasConditionalRequirements) {
-        for (const auto& principle : requiredPrinciples) {
-            if (!player->hasPrinciple(principle)) {
-                return false;
-            }
-        }
-
-        for (const auto& trait : requiredTraits) {
-            if (!player->hasTrait(trait)) {
-                return false;
-            }
-        }
-
-        for (const auto& item : requiredStoryItems) {
-            if (!player->hasStoryItem(item)) {
-                return false;
-            }
-        }
+    if (!player->getPrincipleFlags().containsAll(m_requiredPrincipleMask) ||
+        !player->getTraitFlags().containsAll(m_requiredTraitMask) ||
+        !player->getStoryItemFlags().containsAll(m_requiredStoryItemMask)) {
+        return false;
     }
 
     if (energyRequired > 0.0f && player->getEnergy() < energyRequired) {
@@ -55,6 +37,68 @@ bool NotebookChoice::isAvailable(const PlayerState* player) const {
     return true;
 }
 
+void NotebookChoice::requirePrinciple(StringId principle) {
+    m_requiredPrinciples.push_back(principle);
+    m_requiredPrincipleMask.add(principle);
+}
+
+void NotebookChoice::requireTrait(StringId trait) {
+    m_requiredTraits.push_back(trait);
+    m_requiredTraitMask.add(trait);
+}
+
+void NotebookChoice::requireStoryItem(StringId item) {
+    m_requiredStoryItems.push_back(item);
+    m_requiredStoryItemMask.add(item);
+}
+
+void NotebookChoice::clearRequirements() {
+    m_requiredPrinciples.clear();
+    m_requiredTraits.clear();
+    m_requiredStoryItems.clear();
+    m_requiredPrincipleMask.clear();
+    m_requiredTraitMask.clear();
+    m_requiredStoryItemMask.clear();
+}
+
+void NotebookChoice::applyEffects(PlayerState* player) const {
+    if (!player) {
+        return;
+    }
+
+    for (const auto& effect : effects) {
+        switch (effect.type) {
+            case ChoiceEffectType::TRAIT:
+                player->addTrait(effect.id);
+                break;
+            case ChoiceEffectType::PRINCIPLE:
+                player->addPrinciple(effect.id);
+                break;
+            case ChoiceEffectType::STORY_ITEM:
+                player->addStoryItem(effect.id);
+                break;
+            case ChoiceEffectType::ENERGY:
+                player->modifyEnergy(effect.amount);
+                break;
+            case ChoiceEffectType::FUEL:
+                player->addFuel(effect.amount);
+                break;
+            case ChoiceEffectType::MONEY:
+                player->modifyMoney(effect.amount);
+                break;
+            case ChoiceEffectType::MOOD:
+                player->modifyMood(effect.amount);
+                break;
+            case ChoiceEffectType::REPUTATION:
+                player->modifyReputation(static_cast<int>(effect.amount));
+                break;
+            case ChoiceEffectType::VEHICLE_CONDITION:
+                player->modifyVehicleCondition(effect.amount);
+                break;
+        }
+    }
+}
+
 
 
 NotebookEntry::NotebookEntry()
@@ -0,0 +1,73 @@
+#include "Notebook/StoryContent.h"
+#include "FontLoader.h"
+#include "EventFactory.h"
+#include <iostream>
+
+
+StoryContent::StoryContent()
+    : m_fontLoaded(false) {
+
+
+
+
+
+    std::size_t internErrors = StringId::getInternErrorCount();
+    if (m_pack.open(StoryPackFormat::DEFAULT_PATH)) {
+        std::vector<LazyEntry>(m_pack.getEntryCount()).swap(m_entries);
+        m_index.reserve(m_pack.getEntryCount());
+        for (std::size_t i = 0; i < m_pack.getEntryCount(); i++) {
+            m_index.emplace(StringId(m_pack.getEntry(i).getId()), i);
+        }
+        if (StringId::getInternErrorCount() != internErrors) {
+            std::cerr << "[StoryContent] Story pack has conflicting ids, notebook entries discarded" << std::endl;
+            m_index.clear();
+        } else {
+            std::cout << "[StoryContent] Indexed " << m_index.size() << " notebook entries" << std::endl;
+        }
+    } else {
+        std::cerr << "[StoryContent] Story pack unavailable, notebook entries will be missing" << std::endl;
+    }
+
+    if (auto fontOpt = FontLoader::load()) {
+        m_font = *fontOpt;
+        m_fontLoaded = true;
+        std::cout << "[StoryContent] Font loaded once for all notebook scenes" << std::endl;
+    } else {
+        std::cerr << "[StoryContent] Failed to load fonts" << std::endl;
+    }
+
+
+    EventFactory::initializeAllEvents(m_eventManager);
+    m_eventManager.buildIndex();
+    std::cout << "[StoryContent] EventManager initialized with "
+              << m_eventManager.getAllEvents().size() << " events" << std::endl;
+}
+
+StoryContent& StoryContent::getInstance() {
+    static StoryContent instance;
+    return instance;
+}
+
+const NotebookEntry* StoryContent::findEntry(StringId entryId) const {
+    auto it = m_index.find(entryId);
+    if (it == m_index.end()) {
+        return nullptr;
+    }
+
+
+
+    LazyEntry& slot = m_entries[it->second];
+    std::size_t packIndex = it->second;
+    std::call_once(slot.once, [this, &slot, packIndex]() {
+        slot.entry.emplace(m_pack.materialize(m_pack.getEntry(packIndex)));
+    });
+    return &*slot.entry;
+}
+
+bool StoryContent::hasEntry(StringId entryId) const {
+    return m_index.count(entryId) > 0;
+}
+
+const sf::Font* StoryContent::getFont() const {
+    return m_fontLoaded ? &m_font : nullptr;
+}
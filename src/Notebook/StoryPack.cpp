@@ -0,0 +1,356 @@
+#include "Notebook/StoryPack.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace StoryPackFormat;
+
+
+namespace {
+
+bool sectionFits(const Range& section, std::size_t recordSize, std::size_t fileSize) {
+    if (section.first % alignof(std::uint32_t) != 0) {
+        return false;
+    }
+    std::size_t end = static_cast<std::size_t>(section.first) +
+                      static_cast<std::size_t>(section.count) * recordSize;
+    return end <= fileSize;
+}
+
+bool rangeFits(const Range& range, std::uint32_t tableSize) {
+    return static_cast<std::uint64_t>(range.first) + range.count <= tableSize;
+}
+
+}
+
+
+
+std::string_view StoryPack::ChoiceView::getText() const {
+    return m_pack->getString(m_record->text);
+}
+
+std::string_view StoryPack::ChoiceView::getDisabledReason() const {
+    return m_pack->getString(m_record->disabledReason);
+}
+
+std::string_view StoryPack::ChoiceView::getNextEntryId(std::size_t index) const {
+    return m_pack->getId(m_record->nextEntryIds.first + static_cast<std::uint32_t>(index));
+}
+
+std::string_view StoryPack::ChoiceView::getRequiredPrinciple(std::size_t index) const {
+    return m_pack->getId(m_record->requiredPrinciples.first + static_cast<std::uint32_t>(index));
+}
+
+std::string_view StoryPack::ChoiceView::getRequiredTrait(std::size_t index) const {
+    return m_pack->getId(m_record->requiredTraits.first + static_cast<std::uint32_t>(index));
+}
+
+std::string_view StoryPack::ChoiceView::getRequiredStoryItem(std::size_t index) const {
+    return m_pack->getId(m_record->requiredStoryItems.first + static_cast<std::uint32_t>(index));
+}
+
+ChoiceEffectType StoryPack::ChoiceView::getEffectType(std::size_t index) const {
+    const EffectRecord* effect = m_pack->getEffectRecord(m_record->effects.first + static_cast<std::uint32_t>(index));
+    return static_cast<ChoiceEffectType>(effect->type);
+}
+
+float StoryPack::ChoiceView::getEffectAmount(std::size_t index) const {
+    const EffectRecord* effect = m_pack->getEffectRecord(m_record->effects.first + static_cast<std::uint32_t>(index));
+    return effect->amount;
+}
+
+std::string_view StoryPack::ChoiceView::getEffectId(std::size_t index) const {
+    const EffectRecord* effect = m_pack->getEffectRecord(m_record->effects.first + static_cast<std::uint32_t>(index));
+    return m_pack->getString(effect->id);
+}
+
+
+
+std::string_view StoryPack::EntryView::getId() const {
+    return m_pack->getString(m_record->id);
+}
+
+std::string_view StoryPack::EntryView::getText() const {
+    return m_pack->getString(m_record->text);
+}
+
+std::string_view StoryPack::EntryView::getDate() const {
+    return m_pack->getString(m_record->date);
+}
+
+std::string_view StoryPack::EntryView::getLocation() const {
+    return m_pack->getString(m_record->location);
+}
+
+std::string_view StoryPack::EntryView::getMood() const {
+    return m_pack->getString(m_record->mood);
+}
+
+std::string_view StoryPack::EntryView::getBranchId() const {
+    return m_pack->getString(m_record->branchId);
+}
+
+StoryPack::ChoiceView StoryPack::EntryView::getChoice(std::size_t index) const {
+    return ChoiceView(m_pack, m_pack->getChoiceRecord(m_record->choices.first + static_cast<std::uint32_t>(index)));
+}
+
+
+
+StoryPack::StoryPack()
+    : m_data(nullptr),
+      m_size(0),
+      m_mapped(false) {
+}
+
+StoryPack::~StoryPack() {
+    close();
+}
+
+bool StoryPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    if (!readIntoBuffer(path)) {
+        return false;
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[StoryPack] Cannot open story pack: " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header))) {
+        std::cerr << "[StoryPack] Story pack is too small: " << path << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapped != MAP_FAILED) {
+        m_data = static_cast<const unsigned char*>(mapped);
+        m_size = static_cast<std::size_t>(info.st_size);
+        m_mapped = true;
+    } else {
+        std::cerr << "[StoryPack] mmap failed, reading story pack into memory: " << path << std::endl;
+        if (!readIntoBuffer(path)) {
+            return false;
+        }
+    }
+#endif
+
+    if (!validate()) {
+        std::cerr << "[StoryPack] Invalid story pack: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    std::cout << "[StoryPack] " << (m_mapped ? "Mapped " : "Loaded ") << getEntryCount() << " entries ("
+              << m_size << " bytes) from " << path << std::endl;
+    return true;
+}
+
+bool StoryPack::readIntoBuffer(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::cerr << "[StoryPack] Cannot open story pack: " << path << std::endl;
+        return false;
+    }
+
+    std::streamoff size = file.tellg();
+    if (size < static_cast<std::streamoff>(sizeof(Header))) {
+        std::cerr << "[StoryPack] Story pack is too small: " << path << std::endl;
+        return false;
+    }
+
+    m_buffer.resize(static_cast<std::size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(m_buffer.data()), size)) {
+        std::cerr << "[StoryPack] Failed to read story pack: " << path << std::endl;
+        m_buffer.clear();
+        return false;
+    }
+
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+}
+
+void StoryPack::close() {
+#ifndef _WIN32
+    if (m_data && m_mapped) {
+        ::munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+#endif
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+}
+
+std::size_t StoryPack::getEntryCount() const {
+    return m_data ? header()->entries.count : 0;
+}
+
+StoryPack::EntryView StoryPack::getEntry(std::size_t index) const {
+    const auto* records = reinterpret_cast<const EntryRecord*>(m_data + header()->entries.first);
+    return EntryView(this, &records[index]);
+}
+
+std::optional<StoryPack::EntryView> StoryPack::findEntry(std::string_view entryId) const {
+    if (!m_data) {
+        return std::nullopt;
+    }
+
+    const auto* first = reinterpret_cast<const EntryRecord*>(m_data + header()->entries.first);
+    const auto* last = first + header()->entries.count;
+
+
+    const auto* it = std::lower_bound(first, last, entryId,
+        [this](const EntryRecord& record, std::string_view id) {
+            return getString(record.id) < id;
+        });
+
+    if (it == last || getString(it->id) != entryId) {
+        return std::nullopt;
+    }
+    return EntryView(this, it);
+}
+
+NotebookEntry StoryPack::materialize(const EntryView& view) const {
+    NotebookEntry entry(std::string(view.getId()), view.getType(), std::string(view.getText()));
+    entry.printSpeed = view.getPrintSpeed();
+    entry.canSkip = view.canSkip();
+    entry.date = std::string(view.getDate());
+    entry.location = std::string(view.getLocation());
+    entry.mood = std::string(view.getMood());
+    entry.branchId = std::string(view.getBranchId());
+
+    entry.choices.reserve(view.getChoiceCount());
+    for (std::size_t i = 0; i < view.getChoiceCount(); i++) {
+        ChoiceView source = view.getChoice(i);
+
+        NotebookChoice choice;
+        choice.text = std::string(source.getText());
+        choice.probability = source.getProbability();
+        choice.quitsGame = source.quitsGame();
+        choice.energyRequired = source.getEnergyRequired();
+        choice.fuelRequired = source.getFuelRequired();
+        choice.moneyRequired = source.getMoneyRequired();
+        choice.isDisabled = source.isDisabled();
+        choice.disabledReason = std::string(source.getDisabledReason());
+        choice.isHidden = source.isHidden();
+
+        for (std::size_t n = 0; n < source.getNextEntryCount(); n++) {
+            choice.nextEntryIds.emplace_back(source.getNextEntryId(n));
+        }
+        for (std::size_t n = 0; n < source.getRequiredPrincipleCount(); n++) {
+            choice.requirePrinciple(source.getRequiredPrinciple(n));
+        }
+        for (std::size_t n = 0; n < source.getRequiredTraitCount(); n++) {
+            choice.requireTrait(source.getRequiredTrait(n));
+        }
+        for (std::size_t n = 0; n < source.getRequiredStoryItemCount(); n++) {
+            choice.requireStoryItem(source.getRequiredStoryItem(n));
+        }
+        for (std::size_t n = 0; n < source.getEffectCount(); n++) {
+            ChoiceEffect effect;
+            effect.type = source.getEffectType(n);
+            effect.amount = source.getEffectAmount(n);
+            effect.id = StringId(source.getEffectId(n));
+            choice.effects.push_back(effect);
+        }
+
+        entry.addChoice(choice);
+    }
+
+    return entry;
+}
+
+const Header* StoryPack::header() const {
+    return reinterpret_cast<const Header*>(m_data);
+}
+
+std::string_view StoryPack::getString(const StringRef& ref) const {
+    const Range& strings = header()->strings;
+    if (static_cast<std::uint64_t>(ref.offset) + ref.length > strings.count) {
+        return std::string_view();
+    }
+    return std::string_view(reinterpret_cast<const char*>(m_data + strings.first + ref.offset), ref.length);
+}
+
+std::string_view StoryPack::getId(std::uint32_t index) const {
+    const auto* ids = reinterpret_cast<const StringRef*>(m_data + header()->ids.first);
+    return getString(ids[index]);
+}
+
+const ChoiceRecord* StoryPack::getChoiceRecord(std::uint32_t index) const {
+    const auto* choices = reinterpret_cast<const ChoiceRecord*>(m_data + header()->choices.first);
+    return &choices[index];
+}
+
+const EffectRecord* StoryPack::getEffectRecord(std::uint32_t index) const {
+    const auto* effects = reinterpret_cast<const EffectRecord*>(m_data + header()->effects.first);
+    return &effects[index];
+}
+
+bool StoryPack::validate() const {
+    const Header* h = header();
+
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    if (h->version != VERSION || h->fileSize != m_size) {
+        return false;
+    }
+
+    if (!sectionFits(h->entries, sizeof(EntryRecord), m_size) ||
+        !sectionFits(h->choices, sizeof(ChoiceRecord), m_size) ||
+        !sectionFits(h->ids, sizeof(StringRef), m_size) ||
+        !sectionFits(h->effects, sizeof(EffectRecord), m_size) ||
+        !sectionFits(h->strings, 1, m_size)) {
+        return false;
+    }
+
+
+    const auto* entries = reinterpret_cast<const EntryRecord*>(m_data + h->entries.first);
+    for (std::uint32_t i = 0; i < h->entries.count; i++) {
+        if (entries[i].type > static_cast<std::uint32_t>(EntryType::THOUGHT) ||
+            !rangeFits(entries[i].choices, h->choices.count)) {
+            return false;
+        }
+    }
+
+    const auto* choices = reinterpret_cast<const ChoiceRecord*>(m_data + h->choices.first);
+    for (std::uint32_t i = 0; i < h->choices.count; i++) {
+        const ChoiceRecord& choice = choices[i];
+        if (!rangeFits(choice.nextEntryIds, h->ids.count) ||
+            !rangeFits(choice.requiredPrinciples, h->ids.count) ||
+            !rangeFits(choice.requiredTraits, h->ids.count) ||
+            !rangeFits(choice.requiredStoryItems, h->ids.count) ||
+            !rangeFits(choice.effects, h->effects.count)) {
+            return false;
+        }
+    }
+
+    const auto* effects = reinterpret_cast<const EffectRecord*>(m_data + h->effects.first);
+    for (std::uint32_t i = 0; i < h->effects.count; i++) {
+        if (effects[i].type > static_cast<std::uint32_t>(ChoiceEffectType::VEHICLE_CONDITION)) {
+            return false;
+        }
+    }
+
+    return true;
+}
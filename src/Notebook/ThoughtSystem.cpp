@@ -1,6 +1,4 @@
 #include "Notebook/ThoughtSystem.h"
-#include <cstdlib>
-#include <ctime>
 #include <algorithm>
 
 
@@ -13,11 +11,9 @@ ThoughtSystem::ThoughtSystem()
     , m_nextThoughtDelay(FIRST_THOUGHT_DELAY)
     , m_thoughtsSpawned(0)
     , m_testMode(false)
+    , m_random(&RandomService::getInstance().getStream(RandomStreamId::THOUGHTS))
 {
 
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-
-
     initializeThoughts();
 }
 
@@ -109,7 +105,7 @@ std::string ThoughtSystem::getRandomThought() const {
         return "...";
     }
 
-    int index = std::rand() % m_generalThoughts.size();
+    int index = m_random->rangeInt(0, static_cast<int>(m_generalThoughts.size()) - 1);
     return m_generalThoughts[index];
 }
 
@@ -148,43 +148,46 @@ void PlayerState::initializeStartingInventory() {
 
 
 
-void PlayerState::addPrinciple(const std::string& principleId) {
+void PlayerState::addPrinciple(StringId principleId) {
 
-    if (std::find(m_principles.begin(), m_principles.end(), principleId) == m_principles.end()) {
+    if (!m_principleFlags.has(principleId)) {
+        m_principleFlags.add(principleId);
         m_principles.push_back(principleId);
         std::cout << "[PlayerState] Acquired principle: " << principleId << std::endl;
     }
 }
 
 
-void PlayerState::addTrait(const std::string& traitId) {
+void PlayerState::addTrait(StringId traitId) {
 
-    if (std::find(m_traits.begin(), m_traits.end(), traitId) == m_traits.end()) {
+    if (!m_traitFlags.has(traitId)) {
+        m_traitFlags.add(traitId);
         m_traits.push_back(traitId);
         std::cout << "[PlayerState] Acquired trait: " << traitId << std::endl;
     }
 }
 
 
-void PlayerState::addStoryItem(const std::string& itemId) {
+void PlayerState::addStoryItem(StringId itemId) {
 
-    if (std::find(m_storyItems.begin(), m_storyItems.end(), itemId) == m_storyItems.end()) {
+    if (!m_storyItemFlags.has(itemId)) {
+        m_storyItemFlags.add(itemId);
         m_storyItems.push_back(itemId);
         std::cout << "[PlayerState] Acquired story item: " << itemId << std::endl;
     }
 }
 
 
-bool PlayerState::hasPrinciple(const std::string& principleId) const {
-    return std::find(m_principles.begin(), m_principles.end(), principleId) != m_principles.end();
+bool PlayerState::hasPrinciple(StringId principleId) const {
+    return m_principleFlags.has(principleId);
 }
 
 
-bool PlayerState::hasTrait(const std::string& traitId) const {
-    return std::find(m_traits.begin(), m_traits.end(), traitId) != m_traits.end();
+bool PlayerState::hasTrait(StringId traitId) const {
+    return m_traitFlags.has(traitId);
 }
 
 
-bool PlayerState::hasStoryItem(const std::string& itemId) const {
-    return std::find(m_storyItems.begin(), m_storyItems.end(), itemId) != m_storyItems.end();
+bool PlayerState::hasStoryItem(StringId itemId) const {
+    return m_storyItemFlags.has(itemId);
 }
@@ -0,0 +1,231 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+
+namespace {
+
+
+void addToTotals(std::vector<Profiler::ZoneTotal>& totals, const char* name, std::int64_t micros,
+                 std::uint32_t calls) {
+    for (auto& total : totals) {
+        if (total.name == name) {
+            total.totalMicros += micros;
+            total.calls += calls;
+            return;
+        }
+    }
+    totals.push_back({name, micros, calls});
+}
+
+void writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\';
+        }
+        out << *c;
+    }
+    out << '"';
+}
+
+}
+
+
+Profiler::Profiler()
+    : m_enabled(std::getenv("KKURS_PROFILE") != nullptr),
+      m_epoch(std::chrono::steady_clock::now()),
+      m_current(0),
+      m_completedFrames(0),
+      m_nextFrameIndex(0) {
+
+    for (auto& frame : m_frames) {
+        frame.events.reserve(128);
+    }
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+std::int64_t Profiler::now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+std::uint32_t Profiler::currentThreadId() {
+    static std::atomic<std::uint32_t> nextId{0};
+    thread_local std::uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->threadId = currentThreadId();
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        m_threadBuffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Profiler::drainThreadBuffers(FrameStats& frame) {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (std::size_t i = 0; i < m_threadBuffers.size();) {
+        ThreadBuffer& buffer = *m_threadBuffers[i];
+        std::size_t head = buffer.head.load(std::memory_order_acquire);
+        std::size_t tail = buffer.tail.load(std::memory_order_relaxed);
+        for (; tail != head; tail++) {
+            if (frame.events.size() >= MAX_EVENTS_PER_FRAME) {
+                frame.droppedEvents++;
+                continue;
+            }
+            frame.events.push_back(buffer.events[tail % THREAD_BUFFER_CAPACITY]);
+        }
+        buffer.tail.store(tail, std::memory_order_release);
+        frame.droppedEvents += buffer.dropped.exchange(0, std::memory_order_relaxed);
+
+
+
+        if (m_threadBuffers[i].use_count() == 1) {
+            m_threadBuffers[i] = std::move(m_threadBuffers.back());
+            m_threadBuffers.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+void Profiler::beginFrame() {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FrameStats& frame = m_frames[m_current];
+    frame.frameIndex = m_nextFrameIndex++;
+    frame.startMicros = now();
+    frame.durationMicros = 0;
+    frame.events.clear();
+    frame.totals.clear();
+    frame.droppedEvents = 0;
+}
+
+void Profiler::endFrame() {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FrameStats& frame = m_frames[m_current];
+    frame.durationMicros = now() - frame.startMicros;
+    drainThreadBuffers(frame);
+
+    for (const auto& event : frame.events) {
+        addToTotals(frame.totals, event.name, event.durationMicros, 1);
+    }
+    std::sort(frame.totals.begin(), frame.totals.end(),
+              [](const ZoneTotal& a, const ZoneTotal& b) { return a.totalMicros > b.totalMicros; });
+
+    m_current = (m_current + 1) % FRAME_HISTORY;
+    m_completedFrames = std::min(m_completedFrames + 1, FRAME_HISTORY);
+}
+
+void Profiler::recordZone(const char* name, std::int64_t startMicros, std::int64_t endMicros) {
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::size_t head = buffer.head.load(std::memory_order_relaxed);
+    if (head - buffer.tail.load(std::memory_order_acquire) >= THREAD_BUFFER_CAPACITY) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer.events[head % THREAD_BUFFER_CAPACITY] = {name, buffer.threadId, startMicros, endMicros - startMicros};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+const Profiler::FrameStats& Profiler::getFrame(std::size_t age) const {
+    std::size_t index = (m_current + FRAME_HISTORY - 1 - (age % FRAME_HISTORY)) % FRAME_HISTORY;
+    return m_frames[index];
+}
+
+std::vector<Profiler::ZoneTotal> Profiler::getTopZones(std::size_t count, std::size_t frames) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<ZoneTotal> totals;
+    std::size_t available = std::min(frames, m_completedFrames);
+    for (std::size_t age = 0; age < available; age++) {
+        for (const auto& zone : getFrame(age).totals) {
+            addToTotals(totals, zone.name, zone.totalMicros, zone.calls);
+        }
+    }
+
+    std::sort(totals.begin(), totals.end(),
+              [](const ZoneTotal& a, const ZoneTotal& b) { return a.totalMicros > b.totalMicros; });
+    if (totals.size() > count) {
+        totals.resize(count);
+    }
+    return totals;
+}
+
+bool Profiler::dumpChromeTrace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[Profiler] Cannot write trace file: " << path << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::size_t eventCount = 0;
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+
+
+    for (std::size_t age = m_completedFrames; age-- > 0;) {
+        const FrameStats& frame = getFrame(age);
+
+        file << (first ? "" : ",") << "\n{\"name\":\"Frame " << frame.frameIndex
+             << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" << frame.startMicros
+             << ",\"dur\":" << frame.durationMicros << "}";
+        first = false;
+
+        for (const auto& event : frame.events) {
+            file << ",\n{\"name\":";
+            writeJsonString(file, event.name);
+            file << ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+                 << ",\"ts\":" << event.startMicros << ",\"dur\":" << event.durationMicros << "}";
+            eventCount++;
+        }
+    }
+    file << "\n]}\n";
+
+    if (!file.good()) {
+        std::cerr << "[Profiler] Failed while writing trace file: " << path << std::endl;
+        return false;
+    }
+
+    std::cout << "[Profiler] Wrote " << eventCount << " zones from " << m_completedFrames
+              << " frames to " << path << std::endl;
+    return true;
+}
+
+
+
+ProfileZone::ProfileZone(const char* name)
+    : m_name(name),
+      m_start(0),
+      m_active(Profiler::getInstance().isEnabled()) {
+    if (m_active) {
+        m_start = Profiler::getInstance().now();
+    }
+}
+
+ProfileZone::~ProfileZone() {
+    if (m_active) {
+        Profiler& profiler = Profiler::getInstance();
+        profiler.recordZone(m_name, m_start, profiler.now());
+    }
+}
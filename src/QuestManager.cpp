@@ -1,8 +1,338 @@
 #include "QuestManager.h"
 #include "GameStateManager.h"
 #include "ExperienceSystem.h"
+#include "JsonReader.h"
+#include "Profiler.h"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <unordered_set>
+
+
+namespace {
+
+bool parseObjectiveType(std::string_view name, QuestObjectiveType& type) {
+    static const std::pair<std::string_view, QuestObjectiveType> names[] = {
+        {"collect_item", QuestObjectiveType::COLLECT_ITEM},
+        {"deliver_item", QuestObjectiveType::DELIVER_ITEM},
+        {"travel_to", QuestObjectiveType::TRAVEL_TO},
+        {"talk_to_npc", QuestObjectiveType::TALK_TO_NPC},
+        {"complete_event", QuestObjectiveType::COMPLETE_EVENT},
+        {"earn_money", QuestObjectiveType::EARN_MONEY},
+        {"custom", QuestObjectiveType::CUSTOM}
+    };
+    for (const auto& entry : names) {
+        if (entry.first == name) {
+            type = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseDifficulty(std::string_view name, QuestDifficulty& difficulty) {
+    static const std::pair<std::string_view, QuestDifficulty> names[] = {
+        {"easy", QuestDifficulty::EASY},
+        {"medium", QuestDifficulty::MEDIUM},
+        {"hard", QuestDifficulty::HARD},
+        {"extreme", QuestDifficulty::EXTREME}
+    };
+    for (const auto& entry : names) {
+        if (entry.first == name) {
+            difficulty = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+
+
+
+
+
+class QuestFileHandler : public JsonHandler {
+public:
+    QuestFileHandler(const std::string& path, const JsonReader& reader)
+        : m_path(path), m_reader(reader), m_questValid(false) {}
+
+    std::vector<Quest> quests;
+    int errorCount = 0;
+
+    bool startObject() override {
+        Context parent = m_stack.empty() ? Context::NONE : m_stack.back();
+        if (parent == Context::NONE) {
+            m_stack.push_back(Context::ROOT);
+        } else if (parent == Context::QUEST_LIST) {
+            m_quest = Quest();
+            m_questValid = true;
+            m_questLine = m_reader.getLine();
+            m_stack.push_back(Context::QUEST);
+        } else if (parent == Context::QUEST && m_key == "reward") {
+            m_stack.push_back(Context::REWARD);
+        } else if (parent == Context::OBJECTIVE_LIST) {
+            m_objective = QuestObjective();
+            m_hasObjectiveType = false;
+            m_stack.push_back(Context::OBJECTIVE);
+        } else {
+            unexpected();
+            m_stack.push_back(Context::SKIP);
+        }
+        return true;
+    }
+
+    bool endObject() override {
+        Context context = m_stack.back();
+        m_stack.pop_back();
+        if (context == Context::QUEST) {
+            finishQuest();
+        } else if (context == Context::OBJECTIVE) {
+            finishObjective();
+        }
+        return true;
+    }
+
+    bool null() override {
+        return !m_stack.empty() || topLevelScalar();
+    }
+
+    bool startArray() override {
+        Context parent = m_stack.empty() ? Context::NONE : m_stack.back();
+        if (parent == Context::NONE || (parent == Context::ROOT && m_key == "quests")) {
+            m_stack.push_back(Context::QUEST_LIST);
+        } else if (parent == Context::QUEST && m_key == "objectives") {
+            m_stack.push_back(Context::OBJECTIVE_LIST);
+        } else if (parent == Context::REWARD && m_key == "items") {
+            m_stack.push_back(Context::REWARD_ITEMS);
+        } else {
+            unexpected();
+            m_stack.push_back(Context::SKIP);
+        }
+        return true;
+    }
+
+    bool endArray() override {
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool key(std::string_view name) override {
+        m_key.assign(name.data(), name.size());
+        return true;
+    }
+
+    bool string(std::string_view value) override {
+        if (m_stack.empty()) {
+            return topLevelScalar();
+        }
+
+        switch (m_stack.back()) {
+        case Context::QUEST:
+            if (m_key == "id") {
+                m_quest.id = std::string(value);
+            } else if (m_key == "title") {
+                m_quest.title = std::string(value);
+            } else if (m_key == "description") {
+                m_quest.description = std::string(value);
+            } else if (m_key == "giver") {
+                m_quest.questGiverNpcId = std::string(value);
+            } else if (m_key == "completionNpc") {
+                m_quest.completionNpcId = std::string(value);
+            } else if (m_key == "difficulty") {
+                if (!parseDifficulty(value, m_quest.difficulty)) {
+                    error("unknown difficulty '" + std::string(value) + "'");
+                }
+            } else {
+                unexpected();
+            }
+            break;
+
+        case Context::OBJECTIVE:
+            if (m_key == "type") {
+                m_hasObjectiveType = parseObjectiveType(value, m_objective.type);
+                if (!m_hasObjectiveType) {
+                    error("unknown objective type '" + std::string(value) + "'");
+                }
+            } else if (m_key == "description") {
+                m_objective.description = std::string(value);
+            } else if (m_key == "target") {
+                m_objective.targetId = std::string(value);
+            } else {
+                unexpected();
+            }
+            break;
+
+        case Context::REWARD_ITEMS:
+            if (value.empty()) {
+                error("empty reward item id");
+            }
+            m_quest.reward.itemIds.emplace_back(value);
+            break;
+
+        case Context::SKIP:
+            break;
+
+        default:
+            unexpected();
+            break;
+        }
+        return true;
+    }
+
+    bool number(double value) override {
+        if (m_stack.empty()) {
+            return topLevelScalar();
+        }
+
+        Context context = m_stack.back();
+        if (context == Context::SKIP || context == Context::ROOT) {
+            return true;
+        }
+
+        if (!(value >= 0.0 && value <= 1e9) || std::floor(value) != value) {
+            error("'" + m_key + "' must be a non-negative integer");
+            return true;
+        }
+        int amount = static_cast<int>(value);
+
+        if (context == Context::REWARD && m_key == "money") {
+            m_quest.reward.money = amount;
+        } else if (context == Context::REWARD && m_key == "experience") {
+            m_quest.reward.experience = amount;
+        } else if (context == Context::OBJECTIVE && m_key == "amount") {
+            m_objective.targetAmount = amount;
+        } else {
+            unexpected();
+        }
+        return true;
+    }
+
+    bool boolean(bool value) override {
+        if (m_stack.empty()) {
+            return topLevelScalar();
+        }
+
+        if (m_stack.back() == Context::QUEST && m_key == "repeatable") {
+            m_quest.repeatable = value;
+        } else if (m_stack.back() != Context::SKIP && m_stack.back() != Context::ROOT) {
+            unexpected();
+        }
+        return true;
+    }
+
+private:
+    enum class Context { NONE, ROOT, QUEST_LIST, QUEST, REWARD, REWARD_ITEMS, OBJECTIVE_LIST, OBJECTIVE, SKIP };
+
+    void error(const std::string& message) {
+        std::cerr << "[QuestManager] " << m_path << ":" << m_reader.getLine() << ": " << message << std::endl;
+        m_questValid = false;
+        errorCount++;
+    }
+
+
+
+    bool topLevelScalar() {
+        error("top-level value must be an object or array");
+        return false;
+    }
+
+    void unexpected() {
+        Context context = m_stack.empty() ? Context::NONE : m_stack.back();
+        if (context != Context::ROOT && context != Context::SKIP) {
+            error("unexpected field '" + m_key + "'");
+        }
+    }
+
+    void finishObjective() {
+        if (!m_hasObjectiveType) {
+            error("objective has no valid type");
+            return;
+        }
+        if (m_objective.targetAmount < 1) {
+            error("objective amount must be at least 1");
+        }
+
+
+        bool needsTarget = m_objective.type != QuestObjectiveType::EARN_MONEY &&
+                           m_objective.type != QuestObjectiveType::CUSTOM;
+        if (needsTarget && m_objective.targetId.empty()) {
+            error("objective '" + m_objective.description + "' has no target");
+        } else if (m_objective.type == QuestObjectiveType::TALK_TO_NPC) {
+            checkReference(m_objective.targetId, NPC_PREFIX, "objective target");
+        } else if (m_objective.type == QuestObjectiveType::COLLECT_ITEM ||
+                   m_objective.type == QuestObjectiveType::DELIVER_ITEM) {
+            checkReference(m_objective.targetId, ITEM_PREFIX, "objective target");
+        }
+        m_quest.objectives.push_back(m_objective);
+    }
+
+
+
+
+
+    static constexpr std::string_view NPC_PREFIX = "npc_";
+    static constexpr std::string_view ITEM_PREFIX = "item_";
+
+    void checkReference(const std::string& id, std::string_view prefix, const char* what) {
+        if (id.compare(0, prefix.size(), prefix) != 0) {
+            error(std::string(what) + " '" + id + "' is not a " + std::string(prefix) + "* id");
+        }
+    }
+
+    void finishQuest() {
+        if (m_quest.id.empty()) {
+            error("quest starting at line " + std::to_string(m_questLine) + " has no id");
+        } else if (!m_seenIds.insert(m_quest.id).second) {
+            error("duplicate quest id '" + m_quest.id + "'");
+        }
+        if (m_quest.title.empty()) {
+            error("quest '" + m_quest.id + "' has no title");
+        }
+        if (m_quest.questGiverNpcId.empty()) {
+            error("quest '" + m_quest.id + "' has no giver");
+        } else {
+            checkReference(m_quest.questGiverNpcId, NPC_PREFIX, "giver");
+        }
+        if (!m_quest.completionNpcId.empty()) {
+            checkReference(m_quest.completionNpcId, NPC_PREFIX, "completion NPC");
+        }
+        for (const auto& itemId : m_quest.reward.itemIds) {
+            if (!itemId.empty()) {
+                checkReference(itemId, ITEM_PREFIX, "reward item");
+            }
+        }
+        if (m_quest.objectives.empty()) {
+            error("quest '" + m_quest.id + "' has no objectives");
+        }
+
+        if (!m_questValid) {
+            std::cerr << "[QuestManager] Skipping invalid quest '" << m_quest.id << "'" << std::endl;
+            return;
+        }
+
+        if (m_quest.completionNpcId.empty()) {
+            m_quest.completionNpcId = m_quest.questGiverNpcId;
+        }
+        quests.push_back(std::move(m_quest));
+    }
+
+    const std::string& m_path;
+    const JsonReader& m_reader;
+
+    std::vector<Context> m_stack;
+    std::string m_key;
+
+    Quest m_quest;
+    bool m_questValid;
+    int m_questLine = 0;
+    QuestObjective m_objective;
+    bool m_hasObjectiveType = false;
+    std::unordered_set<std::string> m_seenIds;
+};
+
+}
 
 
 bool QuestObjective::checkCompletion() {
@@ -45,19 +375,62 @@ QuestManager& QuestManager::getInstance() {
 
 
 void QuestManager::registerQuest(const Quest& quest) {
-    m_quests[quest.id] = quest;
+    storeQuest(quest);
     std::cout << "Quest registered: " << quest.title << " (ID: " << quest.id << ")" << std::endl;
 }
 
-void QuestManager::registerQuestsFromFile(const std::string& jsonPath) {
+Quest& QuestManager::storeQuest(const Quest& quest) {
+    Quest& stored = m_quests[quest.id];
+    unindexQuest(stored);
+    stored = quest;
+    if (stored.status == QuestStatus::ACTIVE) {
+        indexQuest(stored);
+    }
+    return stored;
+}
+
+bool QuestManager::registerQuestsFromFile(const std::string& jsonPath) {
+    ProfileZone zone("QuestManager::registerQuestsFromFile");
+    auto start = std::chrono::steady_clock::now();
+
+    std::size_t internErrors = StringId::getInternErrorCount();
+    JsonReader reader;
+    QuestFileHandler handler(jsonPath, reader);
+    if (!reader.parseFile(jsonPath, handler)) {
+        std::cerr << "[QuestManager] Failed to load " << jsonPath << " (line " << reader.getLine()
+                  << "): " << reader.getError() << std::endl;
+        return false;
+    }
+    if (StringId::getInternErrorCount() != internErrors) {
+        std::cerr << "[QuestManager] Rejecting " << jsonPath << ": conflicting ids" << std::endl;
+        return false;
+    }
+
+
+
+    m_quests.reserve(m_quests.size() + handler.quests.size());
+    for (const auto& quest : handler.quests) {
+        storeQuest(quest);
+    }
 
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    std::cout << "[QuestManager] Loaded " << handler.quests.size() << " quests from " << jsonPath
+              << " in " << elapsed / 1000.0 << " ms";
+    if (handler.errorCount > 0) {
+        std::cout << " (" << handler.errorCount << " errors)";
+    }
+    std::cout << std::endl;
 
-    std::cerr << "Quest loading from JSON not yet implemented: " << jsonPath << std::endl;
-    std::cerr << "Use initializeDefaultQuests() to load hardcoded quests instead" << std::endl;
+    if (handler.quests.empty()) {
+        std::cerr << "[QuestManager] No valid quests in " << jsonPath << std::endl;
+        return false;
+    }
+    return true;
 }
 
 
-Quest* QuestManager::getQuest(const std::string& questId) {
+Quest* QuestManager::getQuest(StringId questId) {
     auto it = m_quests.find(questId);
     if (it != m_quests.end()) {
         return &it->second;
@@ -65,19 +438,19 @@ Quest* QuestManager::getQuest(const std::string& questId) {
     return nullptr;
 }
 
-void QuestManager::startQuest(const std::string& questId) {
+void QuestManager::startQuest(StringId questId) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::NOT_STARTED) {
-        quest->status = QuestStatus::ACTIVE;
+        setQuestStatus(*quest, QuestStatus::ACTIVE);
         std::cout << "Quest started: " << quest->title << std::endl;
     }
 }
 
-void QuestManager::completeQuest(const std::string& questId) {
+void QuestManager::completeQuest(StringId questId) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::ACTIVE) {
         if (quest->areAllObjectivesComplete()) {
-            quest->status = QuestStatus::COMPLETED;
+            setQuestStatus(*quest, QuestStatus::COMPLETED);
             grantReward(questId);
             std::cout << "Quest completed: " << quest->title << std::endl;
         } else {
@@ -86,18 +459,18 @@ void QuestManager::completeQuest(const std::string& questId) {
     }
 }
 
-void QuestManager::failQuest(const std::string& questId) {
+void QuestManager::failQuest(StringId questId) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::ACTIVE) {
-        quest->status = QuestStatus::FAILED;
+        setQuestStatus(*quest, QuestStatus::FAILED);
         std::cout << "Quest failed: " << quest->title << std::endl;
     }
 }
 
-void QuestManager::resetQuest(const std::string& questId) {
+void QuestManager::resetQuest(StringId questId) {
     Quest* quest = getQuest(questId);
     if (quest && quest->repeatable) {
-        quest->status = QuestStatus::NOT_STARTED;
+        setQuestStatus(*quest, QuestStatus::NOT_STARTED);
         for (auto& obj : quest->objectives) {
             obj.currentAmount = 0;
             obj.isCompleted = false;
@@ -148,7 +521,7 @@ std::vector<Quest*> QuestManager::getQuestsFromNPC(const std::string& npcId) {
 }
 
 
-void QuestManager::updateObjective(const std::string& questId, int objectiveIndex, int progress) {
+void QuestManager::updateObjective(StringId questId, int objectiveIndex, int progress) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::ACTIVE) {
         if (objectiveIndex >= 0 && objectiveIndex < static_cast<int>(quest->objectives.size())) {
@@ -159,116 +532,131 @@ void QuestManager::updateObjective(const std::string& questId, int objectiveInde
     }
 }
 
-void QuestManager::incrementObjective(const std::string& questId, int objectiveIndex, int amount) {
+void QuestManager::incrementObjective(StringId questId, int objectiveIndex, int amount) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::ACTIVE) {
         if (objectiveIndex >= 0 && objectiveIndex < static_cast<int>(quest->objectives.size())) {
-            quest->objectives[objectiveIndex].currentAmount += amount;
-            checkObjectiveCompletion(*quest);
-            checkQuestCompletion(*quest);
+            applyIncrement(*quest, objectiveIndex, amount);
         }
     }
 }
 
-void QuestManager::completeObjective(const std::string& questId, int objectiveIndex) {
+void QuestManager::completeObjective(StringId questId, int objectiveIndex) {
     Quest* quest = getQuest(questId);
     if (quest && quest->status == QuestStatus::ACTIVE) {
         if (objectiveIndex >= 0 && objectiveIndex < static_cast<int>(quest->objectives.size())) {
-            quest->objectives[objectiveIndex].isCompleted = true;
-            quest->objectives[objectiveIndex].currentAmount = quest->objectives[objectiveIndex].targetAmount;
-            checkQuestCompletion(*quest);
+            applyComplete(*quest, objectiveIndex);
         }
     }
 }
 
+void QuestManager::applyIncrement(Quest& quest, int objectiveIndex, int amount) {
+    quest.objectives[objectiveIndex].currentAmount += amount;
+    checkObjectiveCompletion(quest);
+    checkQuestCompletion(quest);
+}
+
+void QuestManager::applyComplete(Quest& quest, int objectiveIndex) {
+    QuestObjective& obj = quest.objectives[objectiveIndex];
+    obj.isCompleted = true;
+    obj.currentAmount = obj.targetAmount;
+    checkQuestCompletion(quest);
+}
 
-void QuestManager::notifyItemCollected(const std::string& itemId, int amount) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::COLLECT_ITEM && obj.targetId == itemId) {
-                    incrementObjective(quest.id, static_cast<int>(i), amount);
-                }
-            }
-        }
+
+std::uint64_t QuestManager::makeObjectiveKey(QuestObjectiveType type, StringId targetId) {
+
+
+    if (type == QuestObjectiveType::EARN_MONEY) {
+        targetId = StringId();
     }
+    return (static_cast<std::uint64_t>(type) << 32) | targetId.getHash();
 }
 
-void QuestManager::notifyItemDelivered(const std::string& itemId, const std::string& location, int amount) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::DELIVER_ITEM &&
-                    obj.targetId == itemId) {
-                    incrementObjective(quest.id, static_cast<int>(i), amount);
-                }
-            }
-        }
+void QuestManager::indexQuest(Quest& quest) {
+    for (size_t i = 0; i < quest.objectives.size(); ++i) {
+        const auto& obj = quest.objectives[i];
+        m_objectiveIndex[makeObjectiveKey(obj.type, obj.targetId)].push_back({&quest, static_cast<int>(i)});
     }
 }
 
-void QuestManager::notifyLocationVisited(const std::string& locationId) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::TRAVEL_TO && obj.targetId == locationId) {
-                    completeObjective(quest.id, static_cast<int>(i));
-                }
-            }
+void QuestManager::unindexQuest(Quest& quest) {
+    for (const auto& obj : quest.objectives) {
+        auto it = m_objectiveIndex.find(makeObjectiveKey(obj.type, obj.targetId));
+        if (it == m_objectiveIndex.end()) {
+            continue;
+        }
+
+        auto& refs = it->second;
+        refs.erase(std::remove_if(refs.begin(), refs.end(),
+                                  [&quest](const ObjectiveRef& ref) { return ref.quest == &quest; }),
+                   refs.end());
+        if (refs.empty()) {
+            m_objectiveIndex.erase(it);
         }
     }
 }
 
-void QuestManager::notifyNPCTalkedTo(const std::string& npcId) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::TALK_TO_NPC && obj.targetId == npcId) {
-                    completeObjective(quest.id, static_cast<int>(i));
-                }
-            }
-        }
+void QuestManager::setQuestStatus(Quest& quest, QuestStatus status) {
+    if (quest.status == QuestStatus::ACTIVE && status != QuestStatus::ACTIVE) {
+        unindexQuest(quest);
+    } else if (quest.status != QuestStatus::ACTIVE && status == QuestStatus::ACTIVE) {
+        indexQuest(quest);
     }
+    quest.status = status;
 }
 
-void QuestManager::notifyEventCompleted(const std::string& eventId) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::COMPLETE_EVENT && obj.targetId == eventId) {
-                    completeObjective(quest.id, static_cast<int>(i));
-                }
-            }
-        }
+template<typename Apply>
+void QuestManager::dispatchObjectives(QuestObjectiveType type, StringId targetId, Apply apply) {
+    auto it = m_objectiveIndex.find(makeObjectiveKey(type, targetId));
+    if (it == m_objectiveIndex.end()) {
+        return;
+    }
+
+    for (const auto& ref : it->second) {
+        apply(*ref.quest, ref.objectiveIndex);
     }
 }
 
+
+void QuestManager::notifyItemCollected(const std::string& itemId, int amount) {
+    dispatchObjectives(QuestObjectiveType::COLLECT_ITEM, itemId, [this, amount](Quest& quest, int index) {
+        applyIncrement(quest, index, amount);
+    });
+}
+
+void QuestManager::notifyItemDelivered(const std::string& itemId, const std::string& location, int amount) {
+    dispatchObjectives(QuestObjectiveType::DELIVER_ITEM, itemId, [this, amount](Quest& quest, int index) {
+        applyIncrement(quest, index, amount);
+    });
+}
+
+void QuestManager::notifyLocationVisited(const std::string& locationId) {
+    dispatchObjectives(QuestObjectiveType::TRAVEL_TO, locationId, [this](Quest& quest, int index) {
+        applyComplete(quest, index);
+    });
+}
+
+void QuestManager::notifyNPCTalkedTo(const std::string& npcId) {
+    dispatchObjectives(QuestObjectiveType::TALK_TO_NPC, npcId, [this](Quest& quest, int index) {
+        applyComplete(quest, index);
+    });
+}
+
+void QuestManager::notifyEventCompleted(const std::string& eventId) {
+    dispatchObjectives(QuestObjectiveType::COMPLETE_EVENT, eventId, [this](Quest& quest, int index) {
+        applyComplete(quest, index);
+    });
+}
+
 void QuestManager::notifyMoneyEarned(int amount) {
-    for (auto& pair : m_quests) {
-        Quest& quest = pair.second;
-        if (quest.status == QuestStatus::ACTIVE) {
-            for (size_t i = 0; i < quest.objectives.size(); ++i) {
-                auto& obj = quest.objectives[i];
-                if (obj.type == QuestObjectiveType::EARN_MONEY) {
-                    incrementObjective(quest.id, static_cast<int>(i), amount);
-                }
-            }
-        }
-    }
+    dispatchObjectives(QuestObjectiveType::EARN_MONEY, StringId(), [this, amount](Quest& quest, int index) {
+        applyIncrement(quest, index, amount);
+    });
 }
 
 
-void QuestManager::grantReward(const std::string& questId) {
+void QuestManager::grantReward(StringId questId) {
     Quest* quest = getQuest(questId);
     if (quest) {
         std::cout << "Quest reward granted for: " << quest->title << std::endl;
@@ -485,6 +873,7 @@ void QuestManager::initializeDefaultQuests() {
 
 
 void QuestManager::clear() {
+    m_objectiveIndex.clear();
     m_quests.clear();
 }
 
@@ -0,0 +1,92 @@
+#include "Random.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+
+namespace {
+
+constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+
+std::uint64_t mix64(std::uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+}
+
+
+RandomStream::RandomStream(std::uint64_t seed, std::uint64_t streamKey)
+    : m_key(0),
+      m_streamKey(streamKey),
+      m_counter(0) {
+    reseed(seed);
+}
+
+void RandomStream::reseed(std::uint64_t seed) {
+    m_key = mix64(seed ^ mix64(m_streamKey + GOLDEN_GAMMA));
+    m_counter = 0;
+}
+
+std::uint64_t RandomStream::nextU64() {
+    return mix64(m_key + (++m_counter) * GOLDEN_GAMMA);
+}
+
+float RandomStream::nextFloat() {
+
+    return static_cast<float>(nextU64() >> 40) * (1.0f / 16777216.0f);
+}
+
+float RandomStream::range(float min, float max) {
+    return min + nextFloat() * (max - min);
+}
+
+int RandomStream::rangeInt(int min, int max) {
+    if (max <= min) {
+        return min;
+    }
+
+    std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+    return static_cast<int>(min + static_cast<std::int64_t>(nextU64() % span));
+}
+
+bool RandomStream::chance(float probability) {
+    return nextFloat() < probability;
+}
+
+
+
+RandomService::RandomService()
+    : m_seed(0) {
+
+    std::uint64_t seed = static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+
+    if (const char* env = std::getenv("KKURS_SEED")) {
+        seed = std::strtoull(env, nullptr, 10);
+    }
+
+    for (std::size_t i = 0; i < m_streams.size(); i++) {
+        m_streams[i] = RandomStream(0, i + 1);
+    }
+    setSeed(seed);
+}
+
+RandomService& RandomService::getInstance() {
+    static RandomService instance;
+    return instance;
+}
+
+void RandomService::setSeed(std::uint64_t seed) {
+    m_seed = seed;
+    for (auto& stream : m_streams) {
+        stream.reseed(seed);
+    }
+    std::cout << "[RandomService] Seed: " << seed << " (set KKURS_SEED to replay)" << std::endl;
+}
+
+RandomStream& RandomService::getStream(RandomStreamId id) {
+    return m_streams[static_cast<std::size_t>(id)];
+}
@@ -0,0 +1,232 @@
+#include "SaveFormat.h"
+#include <cstring>
+
+
+namespace {
+
+constexpr std::size_t HEADER_SIZE = sizeof(SaveFormat::MAGIC) + 2 * sizeof(std::uint32_t);
+
+}
+
+
+namespace SaveFormat {
+
+bool isBinary(std::string_view data) {
+    return data.size() >= HEADER_SIZE &&
+           std::memcmp(data.data(), MAGIC, sizeof(MAGIC)) == 0;
+}
+
+void appendU32(std::string& out, std::uint32_t value) {
+    char bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFFu);
+    }
+    out.append(bytes, sizeof(bytes));
+}
+
+std::uint32_t loadU32(const char* bytes) {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+
+
+
+
+std::string encodeMetadata(const SlotMetadata& metadata) {
+    std::string_view entryId = metadata.currentNotebookEntryId;
+
+    Writer writer(METADATA_VERSION, METADATA_MAGIC);
+    writer.writeI64(metadata.timestamp);
+    writer.writeF32(metadata.playTimeSeconds);
+    writer.writeI32(metadata.level);
+    writer.writeI32(metadata.currentNodeId);
+    writer.writeU32(metadata.thumbnailHash);
+    writer.writeString(entryId.substr(0, MAX_METADATA_ENTRY_ID));
+
+    std::string data = writer.finish();
+    data.resize(METADATA_SIZE, '\0');
+    return data;
+}
+
+bool decodeMetadata(std::string_view data, SlotMetadata& metadata) {
+    if (data.size() < METADATA_SIZE ||
+        std::memcmp(data.data(), METADATA_MAGIC, sizeof(METADATA_MAGIC)) != 0) {
+        return false;
+    }
+
+    Reader reader(data.substr(HEADER_SIZE, METADATA_SIZE - HEADER_SIZE));
+    metadata.timestamp = reader.readI64();
+    metadata.playTimeSeconds = reader.readF32();
+    metadata.level = reader.readI32();
+    metadata.currentNodeId = reader.readI32();
+    metadata.thumbnailHash = reader.readU32();
+    metadata.currentNotebookEntryId = std::string(reader.readString());
+    return reader.ok();
+}
+
+
+
+
+Writer::Writer(std::uint32_t version, const char* magic)
+    : m_sectionStart(0),
+      m_sectionCount(0) {
+    m_data.append(magic, sizeof(MAGIC));
+    writeU32(version);
+    writeU32(0);
+}
+
+void Writer::beginSection(std::uint32_t tag) {
+    writeU32(tag);
+    m_sectionStart = m_data.size();
+    writeU32(0);
+}
+
+void Writer::endSection() {
+    std::size_t bodySize = m_data.size() - m_sectionStart - sizeof(std::uint32_t);
+    patchU32(m_sectionStart, static_cast<std::uint32_t>(bodySize));
+    m_sectionCount++;
+}
+
+void Writer::writeU32(std::uint32_t value) {
+    appendU32(m_data, value);
+}
+
+void Writer::writeI32(std::int32_t value) {
+    writeU32(static_cast<std::uint32_t>(value));
+}
+
+void Writer::writeI64(std::int64_t value) {
+    std::uint64_t bits = static_cast<std::uint64_t>(value);
+    writeU32(static_cast<std::uint32_t>(bits & 0xFFFFFFFFu));
+    writeU32(static_cast<std::uint32_t>(bits >> 32));
+}
+
+void Writer::writeF32(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeU32(bits);
+}
+
+void Writer::writeBool(bool value) {
+    m_data.push_back(value ? 1 : 0);
+}
+
+void Writer::writeString(std::string_view value) {
+    writeU32(static_cast<std::uint32_t>(value.size()));
+    m_data.append(value.data(), value.size());
+}
+
+std::string Writer::finish() {
+    patchU32(sizeof(MAGIC) + sizeof(std::uint32_t), m_sectionCount);
+    return std::move(m_data);
+}
+
+void Writer::patchU32(std::size_t offset, std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        m_data[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFFu);
+    }
+}
+
+
+
+
+bool Reader::require(std::size_t size) {
+    if (!m_ok || m_data.size() - m_offset < size) {
+        m_ok = false;
+        return false;
+    }
+    return true;
+}
+
+std::uint32_t Reader::readU32() {
+    if (!require(4)) {
+        return 0;
+    }
+
+    std::uint32_t value = loadU32(m_data.data() + m_offset);
+    m_offset += 4;
+    return value;
+}
+
+std::int32_t Reader::readI32() {
+    return static_cast<std::int32_t>(readU32());
+}
+
+std::int64_t Reader::readI64() {
+    std::uint64_t low = readU32();
+    std::uint64_t high = readU32();
+    return static_cast<std::int64_t>(low | (high << 32));
+}
+
+float Reader::readF32() {
+    std::uint32_t bits = readU32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+bool Reader::readBool() {
+    if (!require(1)) {
+        return false;
+    }
+    return m_data[m_offset++] != 0;
+}
+
+std::string_view Reader::readString() {
+    std::uint32_t length = readU32();
+    if (!require(length)) {
+        return {};
+    }
+
+    std::string_view value = m_data.substr(m_offset, length);
+    m_offset += length;
+    return value;
+}
+
+std::uint32_t Reader::readCount(std::size_t minElementSize) {
+    std::uint32_t count = readU32();
+    if (m_ok && minElementSize > 0 && count > (m_data.size() - m_offset) / minElementSize) {
+        m_ok = false;
+        return 0;
+    }
+    return count;
+}
+
+
+
+
+bool File::open(std::string_view data) {
+    if (!isBinary(data)) {
+        return false;
+    }
+
+    m_reader = Reader(data.substr(sizeof(MAGIC)));
+    m_version = m_reader.readU32();
+    m_sectionCount = m_reader.readU32();
+    m_sectionsRead = 0;
+    return m_reader.ok();
+}
+
+bool File::nextSection(Section& section) {
+    if (m_sectionsRead >= m_sectionCount || !m_reader.ok()) {
+        return false;
+    }
+
+    section.tag = m_reader.readU32();
+    section.body = m_reader.readString();
+    if (!m_reader.ok()) {
+        return false;
+    }
+
+    m_sectionsRead++;
+    return true;
+}
+
+bool File::isComplete() const {
+    return m_reader.ok() && m_sectionsRead == m_sectionCount && m_reader.atEnd();
+}
+
+}
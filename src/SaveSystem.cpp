@@ -3,21 +3,194 @@
 #include "QuestManager.h"
 #include "NPC.h"
 #include "ExperienceSystem.h"
+#include "Profiler.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
 #ifdef _WIN32
 #include <direct.h>
+#include <io.h>
 #define mkdir(path, mode) _mkdir(path)
+#define fsync(fd) _commit(fd)
+#else
+#include <unistd.h>
 #endif
 
 
+namespace {
+
+const char SAVE_HEADER_TAG[] = "KKSAVE";
+const char JOURNAL_MAGIC[4] = {'K', 'K', 'J', 'R'};
+constexpr std::size_t SAVE_HEADER_MAX = 64;
+
+
+std::uint32_t crc32(std::string_view data) {
+    static const std::array<std::uint32_t, 256> table = []() {
+        std::array<std::uint32_t, 256> result{};
+        for (std::uint32_t i = 0; i < 256; i++) {
+            std::uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1u) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+            }
+            result[i] = value;
+        }
+        return result;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char byte : data) {
+        crc = table[(crc ^ byte) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+
+bool writeAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+        auto written = ::write(fd, data, static_cast<unsigned int>(size));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+
+void syncDirectory(const std::string& filename) {
+#ifndef _WIN32
+    std::size_t slash = filename.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : filename.substr(0, slash);
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)filename;
+#endif
+}
+
+
+bool writeFileAtomically(const std::string& filename, const std::string& contents) {
+    std::string tempName = filename + ".tmp";
+    int fd = ::open(tempName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "Cannot create " << tempName << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    bool ok = writeAll(fd, contents.data(), contents.size()) && ::fsync(fd) == 0;
+    ok = (::close(fd) == 0) && ok;
+
+    if (!ok || std::rename(tempName.c_str(), filename.c_str()) != 0) {
+        std::cerr << "Failed to write " << filename << ": " << std::strerror(errno) << std::endl;
+        std::remove(tempName.c_str());
+        return false;
+    }
+
+    syncDirectory(filename);
+    return true;
+}
+
+
+SaveFormat::SlotMetadata makeMetadata(const SaveSnapshot& snapshot) {
+    SaveFormat::SlotMetadata metadata;
+    metadata.timestamp = static_cast<std::int64_t>(snapshot.timestamp);
+    metadata.playTimeSeconds = snapshot.playTime;
+    metadata.level = snapshot.level;
+    metadata.currentNodeId = snapshot.currentNodeId;
+    metadata.currentNotebookEntryId = snapshot.currentNotebookEntryId;
+    metadata.thumbnailHash = StringIdHash::fnv1a(snapshot.currentNotebookEntryId.data(),
+                                                 snapshot.currentNotebookEntryId.size());
+    return metadata;
+}
+
+
+bool sameQuest(const SaveSnapshot::QuestState& a, const SaveSnapshot::QuestState& b) {
+    if (a.status != b.status || a.objectives.size() != b.objectives.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.objectives.size(); i++) {
+        const auto& x = a.objectives[i];
+        const auto& y = b.objectives[i];
+        if (x.type != y.type || x.currentAmount != y.currentAmount ||
+            x.targetAmount != y.targetAmount || x.completed != y.completed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameInventory(const SaveSnapshot& a, const SaveSnapshot& b) {
+    if (a.hasInventory != b.hasInventory || a.maxInventoryWeight != b.maxInventoryWeight ||
+        a.inventory.size() != b.inventory.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.inventory.size(); i++) {
+        const auto& x = a.inventory[i];
+        const auto& y = b.inventory[i];
+        if (x.slot != y.slot || x.count != y.count || x.name != y.name ||
+            x.description != y.description || x.category != y.category || x.rarity != y.rarity ||
+            x.value != y.value || x.weight != y.weight || x.stackable != y.stackable ||
+            x.maxStackSize != y.maxStackSize) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameNPCs(const SaveSnapshot& a, const SaveSnapshot& b) {
+    if (a.npcs.size() != b.npcs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.npcs.size(); i++) {
+        const auto& x = a.npcs[i];
+        const auto& y = b.npcs[i];
+        if (x.id != y.id || x.name != y.name || x.level != y.level || x.experience != y.experience ||
+            x.passiveAbilityId != y.passiveAbilityId || x.activeAbilityId != y.activeAbilityId) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+template<typename T>
+bool appendNewFlags(const std::vector<T>& previous, const std::vector<T>& current, std::vector<T>& added) {
+    if (current.size() < previous.size()) {
+        return false;
+    }
+    added.assign(current.begin() + static_cast<std::ptrdiff_t>(previous.size()), current.end());
+    return true;
+}
+
+}
+
+
 SaveSystem::SaveSystem()
-    : m_saveDirectory("saves") {
+    : m_saveDirectory("saves"),
+      m_debugTextExport(false),
+      m_newerSaveOnDisk(false),
+      m_journalBaseChecksum(0),
+      m_journalRecords(0),
+      m_journalBytes(0),
+      m_saveInProgress(false),
+      m_stopSaveWorker(false) {
 
     struct stat info;
     if (stat(m_saveDirectory.c_str(), &info) != 0) {
@@ -27,77 +200,499 @@ SaveSystem::SaveSystem()
 }
 
 
+SaveSystem::~SaveSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_saveMutex);
+        m_stopSaveWorker = true;
+    }
+    m_saveCondition.notify_all();
+
+
+    if (m_saveWorker.joinable()) {
+        m_saveWorker.join();
+    }
+}
+
+
 bool SaveSystem::saveGame(const PlayerState& playerState) {
+    ProfileZone zone("SaveSystem::saveGame");
+
+    waitForPendingSaves();
+    return saveSnapshot(captureSnapshot(playerState));
+}
+
+
+void SaveSystem::saveGameAsync(const PlayerState& playerState) {
+    SaveSnapshot snapshot = captureSnapshot(playerState);
+
+    {
+        std::lock_guard<std::mutex> lock(m_saveMutex);
+        if (m_pendingSnapshot) {
+            std::cout << "[SaveSystem] Coalescing autosave with newer snapshot" << std::endl;
+        }
+        m_pendingSnapshot = std::move(snapshot);
+
+        if (!m_saveWorker.joinable()) {
+            m_saveWorker = std::thread(&SaveSystem::saveWorkerLoop, this);
+        }
+    }
+    m_saveCondition.notify_all();
+}
+
+
+void SaveSystem::waitForPendingSaves() {
+    std::unique_lock<std::mutex> lock(m_saveMutex);
+    m_saveCondition.wait(lock, [this]() { return !m_pendingSnapshot && !m_saveInProgress; });
+}
+
+
+bool SaveSystem::isSavePending() const {
+    std::lock_guard<std::mutex> lock(m_saveMutex);
+    return m_pendingSnapshot.has_value() || m_saveInProgress;
+}
+
+
+void SaveSystem::saveWorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_saveMutex);
+
+    while (true) {
+        m_saveCondition.wait(lock, [this]() { return m_pendingSnapshot || m_stopSaveWorker; });
+
+
+        if (!m_pendingSnapshot) {
+            break;
+        }
+
+        SaveSnapshot snapshot = std::move(*m_pendingSnapshot);
+        m_pendingSnapshot.reset();
+        m_saveInProgress = true;
+        lock.unlock();
+
+        if (!saveIncremental(snapshot)) {
+            std::cerr << "[SaveSystem] Background save failed" << std::endl;
+        }
+
+        lock.lock();
+        m_saveInProgress = false;
+        m_saveCondition.notify_all();
+    }
+}
+
+
+bool SaveSystem::saveSnapshot(const SaveSnapshot& snapshot) {
+    ProfileZone zone("SaveSystem::saveSnapshot");
+
+    if (m_newerSaveOnDisk) {
+        std::cerr << "Refusing to overwrite a save written by a newer build" << std::endl;
+        return false;
+    }
 
     rotateBackups();
 
 
-    std::string data = serializePlayerState(playerState);
+    std::string data = serializeSnapshot(snapshot);
     if (data.empty()) {
         std::cerr << "Failed to serialize player state" << std::endl;
         return false;
     }
 
 
-    if (!writeToFile(getSaveFilePath(), data)) {
+    if (!writeToFile(getSaveFilePath(), data, SaveFormat::encodeMetadata(makeMetadata(snapshot)))) {
         std::cerr << "Failed to write save file" << std::endl;
+        m_lastSaved.reset();
         return false;
     }
 
+
+
+    resetJournal();
+    m_lastSaved = snapshot;
+    m_journalBaseChecksum = crc32(data);
+
+    if (m_debugTextExport) {
+        std::ofstream debugFile(getDebugTextFilePath(), std::ios::trunc);
+        debugFile << serializeSnapshotText(snapshot);
+    }
+
     std::cout << "Game saved successfully" << std::endl;
     return true;
 }
 
 
-bool SaveSystem::loadGame(PlayerState& playerState) {
-    if (!hasSaveFile()) {
-        std::cerr << "No save file found" << std::endl;
+bool SaveSystem::saveIncremental(const SaveSnapshot& snapshot) {
+    ProfileZone zone("SaveSystem::saveIncremental");
+
+    if (!m_lastSaved || m_journalRecords >= JOURNAL_COMPACT_RECORDS ||
+        m_journalBytes >= JOURNAL_COMPACT_BYTES) {
+        return saveSnapshot(snapshot);
+    }
+
+    std::string record;
+    if (!serializeDelta(*m_lastSaved, snapshot, record)) {
+        return saveSnapshot(snapshot);
+    }
+
+    if (!appendJournal(record)) {
+        std::cerr << "Failed to append to save journal, writing a full save" << std::endl;
+        return saveSnapshot(snapshot);
+    }
+
+    m_lastSaved = snapshot;
+    m_journalRecords++;
+    m_journalBytes += record.size();
+    updateSaveMetadata(snapshot);
+    return true;
+}
+
+
+bool SaveSystem::serializeDelta(const SaveSnapshot& previous, const SaveSnapshot& current,
+                                std::string& record) const {
+    if (previous.hasDialogueHistory != current.hasDialogueHistory) {
         return false;
     }
 
-    std::string data = readFromFile(getSaveFilePath());
-    if (data.empty()) {
-        std::cerr << "Failed to read save file" << std::endl;
+
+
+    SaveSnapshot delta;
+    unsigned sections = SECTION_PLAYER;
+
+    delta.timestamp = current.timestamp;
+    delta.playTime = current.playTime;
+    delta.energy = current.energy;
+    delta.money = current.money;
+    delta.fuel = current.fuel;
+    delta.vehicleCondition = current.vehicleCondition;
+    delta.mood = current.mood;
+    delta.reputation = current.reputation;
+    delta.origin = current.origin;
+    delta.carType = current.carType;
+    delta.currentNodeId = current.currentNodeId;
+    delta.currentNotebookEntryId = current.currentNotebookEntryId;
+
+    if (!sameInventory(previous, current)) {
+        sections |= SECTION_INVENTORY;
+        delta.hasInventory = current.hasInventory;
+        delta.maxInventoryWeight = current.maxInventoryWeight;
+        delta.inventory = current.inventory;
+    }
+
+    if (previous.level != current.level || previous.experience != current.experience ||
+        previous.unlockedAbilities != current.unlockedAbilities) {
+        sections |= SECTION_EXPERIENCE;
+        delta.level = current.level;
+        delta.experience = current.experience;
+        delta.unlockedAbilities = current.unlockedAbilities;
+    }
+
+    if (!sameNPCs(previous, current)) {
+        sections |= SECTION_NPCS;
+        delta.npcs = current.npcs;
+    }
+
+
+
+    std::map<std::string, const SaveSnapshot::QuestState*> previousQuests;
+    for (const auto& quest : previous.quests) {
+        previousQuests[quest.id] = &quest;
+    }
+    for (const auto& quest : current.quests) {
+        auto it = previousQuests.find(quest.id);
+        if (it == previousQuests.end() || !sameQuest(*it->second, quest)) {
+            delta.quests.push_back(quest);
+        }
+        if (it != previousQuests.end()) {
+            previousQuests.erase(it);
+        }
+    }
+    if (!previousQuests.empty()) {
+        return false;
+    }
+    if (!delta.quests.empty()) {
+        sections |= SECTION_QUESTS;
+    }
+
+
+    std::map<std::string, std::size_t> previousChoices;
+    for (const auto& dialogue : previous.dialogueHistory) {
+        previousChoices[dialogue.dialogueId] = dialogue.choices.size();
+    }
+    for (const auto& dialogue : current.dialogueHistory) {
+        auto it = previousChoices.find(dialogue.dialogueId);
+        std::size_t known = it != previousChoices.end() ? it->second : 0;
+        if (dialogue.choices.size() < known) {
+            return false;
+        }
+        if (dialogue.choices.size() > known) {
+            delta.dialogueHistory.push_back({dialogue.dialogueId,
+                {dialogue.choices.begin() + static_cast<std::ptrdiff_t>(known), dialogue.choices.end()}});
+        }
+        if (it != previousChoices.end()) {
+            previousChoices.erase(it);
+        }
+    }
+    if (!previousChoices.empty()) {
+        return false;
+    }
+    if (!appendNewFlags(previous.dialogueFlags, current.dialogueFlags, delta.dialogueFlags)) {
         return false;
     }
+    if (!delta.dialogueHistory.empty() || !delta.dialogueFlags.empty()) {
+        sections |= SECTION_DIALOGUE;
+        delta.hasDialogueHistory = true;
+    }
+
 
-    if (!deserializePlayerState(data, playerState)) {
-        std::cerr << "Failed to deserialize save data" << std::endl;
+    if (!appendNewFlags(previous.principles, current.principles, delta.principles) ||
+        !appendNewFlags(previous.traits, current.traits, delta.traits) ||
+        !appendNewFlags(previous.storyItems, current.storyItems, delta.storyItems)) {
         return false;
     }
+    if (!delta.principles.empty() || !delta.traits.empty() || !delta.storyItems.empty()) {
+        sections |= SECTION_FLAGS;
+    }
 
-    std::cout << "Game loaded successfully" << std::endl;
+    record = serializeSections(delta, sections);
     return true;
 }
 
 
+bool SaveSystem::appendJournal(const std::string& record) {
+    ProfileZone zone("SaveSystem::appendJournal");
+
+    const bool startJournal = m_journalRecords == 0;
+    std::string frame;
+    if (startJournal) {
+        frame.append(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+        SaveFormat::appendU32(frame, m_journalBaseChecksum);
+    }
+    SaveFormat::appendU32(frame, static_cast<std::uint32_t>(record.size()));
+    SaveFormat::appendU32(frame, crc32(record));
+    frame += record;
+
+    std::string path = getJournalFilePath();
+    int flags = O_WRONLY | O_CREAT | (startJournal ? O_TRUNC : O_APPEND);
+    int fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        std::cerr << "Cannot open " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    bool ok = writeAll(fd, frame.data(), frame.size()) && ::fsync(fd) == 0;
+    ok = (::close(fd) == 0) && ok;
+    if (!ok) {
+        std::cerr << "Failed to write " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    if (startJournal) {
+        syncDirectory(path);
+    }
+    return true;
+}
+
+
+int SaveSystem::replayJournal(std::uint32_t baseChecksum, SaveSnapshot& snapshot) const {
+    std::string journal = readFromFile(getJournalFilePath());
+    if (journal.empty()) {
+        return 0;
+    }
+
+    constexpr std::size_t JOURNAL_HEADER_SIZE = sizeof(JOURNAL_MAGIC) + 4;
+    if (journal.size() < JOURNAL_HEADER_SIZE ||
+        journal.compare(0, sizeof(JOURNAL_MAGIC), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 ||
+        SaveFormat::loadU32(journal.data() + sizeof(JOURNAL_MAGIC)) != baseChecksum) {
+        std::cerr << "Ignoring save journal that does not match the save file" << std::endl;
+        return 0;
+    }
+
+
+
+    std::string_view remaining = std::string_view(journal).substr(JOURNAL_HEADER_SIZE);
+    int replayed = 0;
+    while (remaining.size() >= 8) {
+        std::uint32_t length = SaveFormat::loadU32(remaining.data());
+        std::uint32_t checksum = SaveFormat::loadU32(remaining.data() + 4);
+        if (remaining.size() - 8 < length) {
+            std::cerr << "Save journal ends with a partial record, ignoring it" << std::endl;
+            break;
+        }
+
+        std::string_view record = remaining.substr(8, length);
+        if (crc32(record) != checksum || !decodeBinarySnapshot(record, snapshot)) {
+            std::cerr << "Corrupt save journal record " << replayed << ", ignoring the rest" << std::endl;
+            break;
+        }
+
+        remaining.remove_prefix(8 + length);
+        replayed++;
+    }
+    return replayed;
+}
+
+
+void SaveSystem::resetJournal() {
+    std::remove(getJournalFilePath().c_str());
+    std::remove(getMetadataFilePath().c_str());
+    m_journalRecords = 0;
+    m_journalBytes = 0;
+}
+
+
+void SaveSystem::updateSaveMetadata(const SaveSnapshot& snapshot) {
+
+
+
+
+    std::string contents;
+    SaveFormat::appendU32(contents, m_journalBaseChecksum);
+    contents += SaveFormat::encodeMetadata(makeMetadata(snapshot));
+    writeFileAtomically(getMetadataFilePath(), contents);
+}
+
+
+bool SaveSystem::loadGame(PlayerState& playerState) {
+    ProfileZone zone("SaveSystem::loadGame");
+
+    waitForPendingSaves();
+    if (!hasSaveFile()) {
+        std::cerr << "No save file found" << std::endl;
+        return false;
+    }
+
+    if (loadFromFile(getSaveFilePath(), playerState, true)) {
+        std::cout << "Game loaded successfully" << std::endl;
+        return true;
+    }
+    if (m_newerSaveOnDisk) {
+        return false;
+    }
+
+    std::cerr << "Save file is damaged, falling back to the newest valid backup" << std::endl;
+    return loadNewestBackup(playerState, 0);
+}
+
+
 bool SaveSystem::loadBackup(PlayerState& playerState, int backupIndex) {
     if (backupIndex < 0 || backupIndex >= MAX_BACKUPS) {
         std::cerr << "Invalid backup index: " << backupIndex << std::endl;
         return false;
     }
 
+    waitForPendingSaves();
+
     if (!hasBackup(backupIndex)) {
         std::cerr << "Backup " << backupIndex << " does not exist" << std::endl;
         return false;
     }
 
-    std::string data = readFromFile(getBackupFilePath(backupIndex));
-    if (data.empty()) {
-        std::cerr << "Failed to read backup file" << std::endl;
+    return loadNewestBackup(playerState, backupIndex);
+}
+
+
+bool SaveSystem::loadNewestBackup(PlayerState& playerState, int firstIndex) {
+    for (int i = firstIndex; i < MAX_BACKUPS; i++) {
+        if (!hasBackup(i)) {
+            continue;
+        }
+
+        if (loadFromFile(getBackupFilePath(i), playerState)) {
+            std::cout << "Loaded from backup " << i << std::endl;
+            return true;
+        }
+        std::cerr << "Backup " << i << " is damaged, trying an older one" << std::endl;
+    }
+
+    std::cerr << "No valid backup found" << std::endl;
+    return false;
+}
+
+
+bool SaveSystem::loadFromFile(const std::string& filename, PlayerState& playerState, bool withJournal) {
+
+
+    m_lastSaved.reset();
+
+    std::string data;
+    if (!readVerified(filename, data)) {
+        return false;
+    }
+
+    SaveSnapshot snapshot;
+    try {
+        if (!decodeSnapshot(data, snapshot)) {
+            std::cerr << "Failed to deserialize " << filename << std::endl;
+            return false;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Malformed save data in " << filename << ": " << e.what() << std::endl;
         return false;
     }
 
-    if (!deserializePlayerState(data, playerState)) {
-        std::cerr << "Failed to deserialize backup data" << std::endl;
+    if (withJournal) {
+        int replayed = replayJournal(crc32(data), snapshot);
+        if (replayed > 0) {
+            std::cout << "Replayed " << replayed << " journaled saves" << std::endl;
+        }
+    }
+
+    if (!migrateSnapshot(snapshot)) {
+        std::cerr << "Cannot migrate " << filename << " from save version " << snapshot.version
+                  << " to " << SaveFormat::VERSION << std::endl;
+        if (snapshot.version > SaveFormat::VERSION) {
+            m_newerSaveOnDisk = true;
+        }
         return false;
     }
 
-    std::cout << "Loaded from backup " << backupIndex << std::endl;
+    applySnapshot(snapshot, playerState);
     return true;
 }
 
 
+void SaveSystem::registerMigration(std::uint32_t fromVersion, std::uint32_t toVersion, Migration migration) {
+    m_migrations[{fromVersion, toVersion}] = std::move(migration);
+}
+
+
+bool SaveSystem::migrateSnapshot(SaveSnapshot& snapshot) const {
+
+
+
+
+    for (std::uint32_t version = snapshot.version; version > SaveFormat::VERSION; version--) {
+        if (m_migrations.count({version, version - 1}) == 0) {
+            std::cerr << "Save version " << snapshot.version << " is newer than this build and "
+                      << "has no migration from " << version << " to " << version - 1 << std::endl;
+            return false;
+        }
+    }
+
+    while (snapshot.version != SaveFormat::VERSION) {
+        std::uint32_t next = snapshot.version < SaveFormat::VERSION ? snapshot.version + 1
+                                                                    : snapshot.version - 1;
+
+        auto it = m_migrations.find({snapshot.version, next});
+        if (it != m_migrations.end() && !it->second(snapshot)) {
+            return false;
+        }
+        snapshot.version = next;
+    }
+    return true;
+}
+
+
+bool SaveSystem::exportDebugText(const PlayerState& playerState, const std::string& filename) const {
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Cannot write debug save: " << filename << std::endl;
+        return false;
+    }
+
+    file << serializeSnapshotText(captureSnapshot(playerState));
+    return file.good();
+}
+
+
 bool SaveSystem::hasSaveFile() const {
     return fileExists(getSaveFilePath());
 }
@@ -115,29 +710,60 @@ std::vector<SaveSystem::BackupInfo> SaveSystem::getBackupList() const {
     std::vector<BackupInfo> backups;
 
     for (int i = 0; i < MAX_BACKUPS; i++) {
-        BackupInfo info;
-        info.index = i;
-        info.exists = hasBackup(i);
+        backups.push_back(readSlotInfo(i, getBackupFilePath(i)));
+    }
 
-        if (info.exists) {
+    return backups;
+}
 
-            std::string data = readFromFile(getBackupFilePath(i));
 
-            info.timestamp = "backup_" + std::to_string(i);
-            info.nodeId = 0;
-        } else {
-            info.timestamp = "";
-            info.nodeId = -1;
-        }
+SaveSystem::BackupInfo SaveSystem::getSaveInfo() const {
+    return readSlotInfo(-1, getSaveFilePath());
+}
+
 
-        backups.push_back(info);
+SaveSystem::BackupInfo SaveSystem::readSlotInfo(int index, const std::string& filename) const {
+    BackupInfo info;
+    info.index = index;
+    info.exists = fileExists(filename);
+    info.timestamp = "";
+    info.nodeId = -1;
+
+    if (!info.exists) {
+        return info;
     }
 
-    return backups;
+
+
+    SaveFormat::SlotMetadata metadata;
+    if (!readMetadata(filename, metadata)) {
+        info.timestamp = "unknown";
+        return info;
+    }
+
+    info.hasMetadata = true;
+    info.savedAt = static_cast<std::time_t>(metadata.timestamp);
+    info.nodeId = metadata.currentNodeId;
+    info.playTime = metadata.playTimeSeconds;
+    info.level = metadata.level;
+    info.currentNotebookEntryId = metadata.currentNotebookEntryId;
+    info.thumbnailHash = metadata.thumbnailHash;
+
+    char formatted[32];
+    std::tm* local = std::localtime(&info.savedAt);
+    if (local && std::strftime(formatted, sizeof(formatted), "%Y-%m-%d %H:%M", local) > 0) {
+        info.timestamp = formatted;
+    }
+    return info;
 }
 
 
 void SaveSystem::clearAllSaves() {
+    waitForPendingSaves();
+    m_newerSaveOnDisk = false;
+
+    resetJournal();
+    m_lastSaved.reset();
 
     if (hasSaveFile()) {
         std::remove(getSaveFilePath().c_str());
@@ -154,107 +780,274 @@ void SaveSystem::clearAllSaves() {
 }
 
 
-std::string SaveSystem::serializePlayerState(const PlayerState& playerState) const {
-    std::ostringstream oss;
-
+SaveSnapshot SaveSystem::captureSnapshot(const PlayerState& playerState) const {
+    ProfileZone zone("SaveSystem::captureSnapshot");
+    SaveSnapshot snapshot;
 
-    std::time_t now = std::time(nullptr);
-
-
-    oss << "{\n";
-    oss << "  \"version\": 1,\n";
-    oss << "  \"timestamp\": " << now << ",\n";
+    snapshot.timestamp = std::time(nullptr);
+    snapshot.playTime = playerState.getTotalPlayTime();
 
-
-    oss << "  \"energy\": " << playerState.getEnergy() << ",\n";
-    oss << "  \"money\": " << playerState.getMoney() << ",\n";
-    oss << "  \"fuel\": " << playerState.getFuel() << ",\n";
-    oss << "  \"vehicleCondition\": " << playerState.getVehicleCondition() << ",\n";
-    oss << "  \"mood\": " << playerState.getMood() << ",\n";
-    oss << "  \"reputation\": " << playerState.getReputation() << ",\n";
-    oss << "  \"origin\": " << static_cast<int>(playerState.getOrigin()) << ",\n";
-    oss << "  \"carType\": " << static_cast<int>(playerState.getCarType()) << ",\n";
-    oss << "  \"currentNodeId\": " << playerState.getCurrentNodeId() << ",\n";
-    oss << "  \"currentNotebookEntryId\": \"" << playerState.getCurrentNotebookEntryId() << "\",\n";
+    snapshot.energy = playerState.getEnergy();
+    snapshot.money = playerState.getMoney();
+    snapshot.fuel = playerState.getFuel();
+    snapshot.vehicleCondition = playerState.getVehicleCondition();
+    snapshot.mood = playerState.getMood();
+    snapshot.reputation = playerState.getReputation();
+    snapshot.origin = static_cast<int>(playerState.getOrigin());
+    snapshot.carType = static_cast<int>(playerState.getCarType());
+    snapshot.currentNodeId = playerState.getCurrentNodeId();
+    snapshot.currentNotebookEntryId = playerState.getCurrentNotebookEntryId();
 
 
+    ExperienceSystem& expSystem = ExperienceSystem::getInstance();
+    snapshot.level = expSystem.getLevel();
+    snapshot.experience = expSystem.getExperience();
+    for (const auto& ability : expSystem.getAbilityTree()) {
+        if (ability.unlocked) {
+            snapshot.unlockedAbilities.push_back(ability.id);
+        }
+    }
 
 
+    QuestManager& questMgr = QuestManager::getInstance();
+    std::vector<Quest*> allQuests = questMgr.getActiveQuests();
+    std::vector<Quest*> completedQuests = questMgr.getCompletedQuests();
+    allQuests.insert(allQuests.end(), completedQuests.begin(), completedQuests.end());
 
+    snapshot.quests.reserve(allQuests.size());
+    for (const auto* quest : allQuests) {
+        SaveSnapshot::QuestState state;
+        state.id = quest->id;
+        state.status = static_cast<int>(quest->status);
+        for (const auto& obj : quest->objectives) {
+            state.objectives.push_back({static_cast<int>(obj.type), obj.currentAmount,
+                                        obj.targetAmount, obj.isCompleted});
+        }
+        snapshot.quests.push_back(std::move(state));
+    }
 
 
+    for (const auto& npc : NPCManager::getInstance().getTeam()) {
+        SaveSnapshot::NPCState state;
+        state.id = npc->getId();
+        state.name = npc->getName();
+        state.level = npc->getLevel();
+        state.experience = npc->getExperience();
+        state.passiveAbilityId = npc->hasPassiveAbility() ? npc->getPassiveAbility().id : "";
+        state.activeAbilityId = npc->hasActiveAbility() ? npc->getActiveAbility().id : "";
+        snapshot.npcs.push_back(std::move(state));
+    }
 
 
 
+    for (const auto& principle : playerState.getPrinciples()) {
+        snapshot.principles.push_back(principle.str());
+    }
+    for (const auto& trait : playerState.getTraits()) {
+        snapshot.traits.push_back(trait.str());
+    }
+    for (const auto& item : playerState.getStoryItems()) {
+        snapshot.storyItems.push_back(item.str());
+    }
 
 
+    const InventorySystem& inventory = playerState.getInventory();
+    snapshot.hasInventory = true;
+    snapshot.maxInventoryWeight = inventory.getMaxWeight();
+    for (int i = 0; i < inventory.getSlotCount(); i++) {
+        const InventorySlot& slot = inventory.getSlot(i);
+        if (slot.isEmpty) {
+            continue;
+        }
 
+        const Item& item = slot.item;
+        snapshot.inventory.push_back({i, slot.count, item.name, item.description,
+                                      static_cast<int>(item.category), static_cast<int>(item.rarity),
+                                      item.value, item.weight, item.isStackable, item.maxStackSize});
+    }
 
 
+    const DialogueManager& dialogueManager = DialogueManager::getInstance();
+    snapshot.hasDialogueHistory = true;
+    for (const auto& [dialogueId, choices] : dialogueManager.getHistory()) {
+        snapshot.dialogueHistory.push_back({dialogueId.str(), choices});
+    }
+    snapshot.dialogueFlags = dialogueManager.getFlags();
 
+    return snapshot;
+}
 
 
+std::string SaveSystem::serializeSnapshot(const SaveSnapshot& snapshot) const {
+    return serializeSections(snapshot, ALL_SECTIONS);
+}
 
 
+std::string SaveSystem::serializeSections(const SaveSnapshot& snapshot, unsigned sections) const {
+    ProfileZone zone("SaveSystem::serialize");
+    SaveFormat::Writer writer;
+
+    writer.beginSection(SaveFormat::TAG_PLAYER);
+    writer.writeI64(static_cast<std::int64_t>(snapshot.timestamp));
+    writer.writeF32(snapshot.energy);
+    writer.writeF32(snapshot.money);
+    writer.writeF32(snapshot.fuel);
+    writer.writeF32(snapshot.vehicleCondition);
+    writer.writeF32(snapshot.mood);
+    writer.writeI32(snapshot.reputation);
+    writer.writeI32(snapshot.origin);
+    writer.writeI32(snapshot.carType);
+    writer.writeI32(snapshot.currentNodeId);
+    writer.writeString(snapshot.currentNotebookEntryId);
+    writer.writeF32(snapshot.playTime);
+    writer.endSection();
+
+    if ((sections & SECTION_INVENTORY) && snapshot.hasInventory) {
+        writer.beginSection(SaveFormat::TAG_INVENTORY);
+        writer.writeF32(snapshot.maxInventoryWeight);
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.inventory.size()));
+        for (const auto& item : snapshot.inventory) {
+            writer.writeI32(item.slot);
+            writer.writeI32(item.count);
+            writer.writeString(item.name);
+            writer.writeString(item.description);
+            writer.writeI32(item.category);
+            writer.writeI32(item.rarity);
+            writer.writeI32(item.value);
+            writer.writeF32(item.weight);
+            writer.writeBool(item.stackable);
+            writer.writeI32(item.maxStackSize);
+        }
+        writer.endSection();
+    }
 
+    if (sections & SECTION_EXPERIENCE) {
+        writer.beginSection(SaveFormat::TAG_EXPERIENCE);
+        writer.writeI32(snapshot.level);
+        writer.writeI32(snapshot.experience);
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.unlockedAbilities.size()));
+        for (const auto& ability : snapshot.unlockedAbilities) {
+            writer.writeString(ability);
+        }
+        writer.endSection();
+    }
 
+    if (sections & SECTION_QUESTS) {
+        writer.beginSection(SaveFormat::TAG_QUESTS);
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.quests.size()));
+        for (const auto& quest : snapshot.quests) {
+            writer.writeString(quest.id);
+            writer.writeI32(quest.status);
+            writer.writeU32(static_cast<std::uint32_t>(quest.objectives.size()));
+            for (const auto& obj : quest.objectives) {
+                writer.writeI32(obj.type);
+                writer.writeI32(obj.currentAmount);
+                writer.writeI32(obj.targetAmount);
+                writer.writeBool(obj.completed);
+            }
+        }
+        writer.endSection();
+    }
 
+    if (sections & SECTION_NPCS) {
+        writer.beginSection(SaveFormat::TAG_NPCS);
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.npcs.size()));
+        for (const auto& npc : snapshot.npcs) {
+            writer.writeString(npc.id);
+            writer.writeString(npc.name);
+            writer.writeI32(npc.level);
+            writer.writeI32(npc.experience);
+            writer.writeString(npc.passiveAbilityId);
+            writer.writeString(npc.activeAbilityId);
+        }
+        writer.endSection();
+    }
 
+    if ((sections & SECTION_DIALOGUE) && snapshot.hasDialogueHistory) {
+        writer.beginSection(SaveFormat::TAG_DIALOGUE);
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.dialogueHistory.size()));
+        for (const auto& dialogue : snapshot.dialogueHistory) {
+            writer.writeString(dialogue.dialogueId);
+            writer.writeU32(static_cast<std::uint32_t>(dialogue.choices.size()));
+            for (StringId choice : dialogue.choices) {
+                writer.writeU32(choice.getHash());
+            }
+        }
+        writer.writeU32(static_cast<std::uint32_t>(snapshot.dialogueFlags.size()));
+        for (StringId flag : snapshot.dialogueFlags) {
+            writer.writeU32(flag.getHash());
+        }
+        writer.endSection();
+    }
 
+    if (sections & SECTION_FLAGS) {
+        writer.beginSection(SaveFormat::TAG_FLAGS);
+        for (const auto* list : {&snapshot.principles, &snapshot.traits, &snapshot.storyItems}) {
+            writer.writeU32(static_cast<std::uint32_t>(list->size()));
+            for (const auto& flag : *list) {
+                writer.writeString(flag);
+            }
+        }
+        writer.endSection();
+    }
 
+    return writer.finish();
+}
 
 
+std::string SaveSystem::serializeSnapshotText(const SaveSnapshot& snapshot) const {
+    std::ostringstream oss;
 
 
+    oss << "{\n";
+    oss << "  \"version\": " << SaveFormat::TEXT_VERSION << ",\n";
+    oss << "  \"timestamp\": " << snapshot.timestamp << ",\n";
+    oss << "  \"playTime\": " << snapshot.playTime << ",\n";
 
 
+    oss << "  \"energy\": " << snapshot.energy << ",\n";
+    oss << "  \"money\": " << snapshot.money << ",\n";
+    oss << "  \"fuel\": " << snapshot.fuel << ",\n";
+    oss << "  \"vehicleCondition\": " << snapshot.vehicleCondition << ",\n";
+    oss << "  \"mood\": " << snapshot.mood << ",\n";
+    oss << "  \"reputation\": " << snapshot.reputation << ",\n";
+    oss << "  \"origin\": " << snapshot.origin << ",\n";
+    oss << "  \"carType\": " << snapshot.carType << ",\n";
+    oss << "  \"currentNodeId\": " << snapshot.currentNodeId << ",\n";
+    oss << "  \"currentNotebookEntryId\": \"" << snapshot.currentNotebookEntryId << "\",\n";
 
 
-    ExperienceSystem& expSystem = ExperienceSystem::getInstance();
     oss << "  \"experience\": {\n";
-    oss << "    \"level\": " << expSystem.getLevel() << ",\n";
-    oss << "    \"exp\": " << expSystem.getExperience() << ",\n";
+    oss << "    \"level\": " << snapshot.level << ",\n";
+    oss << "    \"exp\": " << snapshot.experience << ",\n";
     oss << "    \"unlockedAbilities\": [\n";
     bool firstAbility = true;
-    for (const auto& ability : expSystem.getAbilityTree()) {
-        if (ability.unlocked) {
-            if (!firstAbility) oss << ",\n";
-            oss << "      \"" << ability.id << "\"";
-            firstAbility = false;
-        }
+    for (const auto& ability : snapshot.unlockedAbilities) {
+        if (!firstAbility) oss << ",\n";
+        oss << "      \"" << ability << "\"";
+        firstAbility = false;
     }
     oss << "\n    ]\n";
     oss << "  },\n";
 
 
-    QuestManager& questMgr = QuestManager::getInstance();
     oss << "  \"quests\": [\n";
     bool firstQuest = true;
-
-
-    auto activeQuests = questMgr.getActiveQuests();
-    auto completedQuests = questMgr.getCompletedQuests();
-
-
-    std::vector<Quest*> allQuests;
-    allQuests.insert(allQuests.end(), activeQuests.begin(), activeQuests.end());
-    allQuests.insert(allQuests.end(), completedQuests.begin(), completedQuests.end());
-
-    for (const auto* quest : allQuests) {
+    for (const auto& quest : snapshot.quests) {
         if (!firstQuest) oss << ",\n";
         oss << "    {\n";
-        oss << "      \"id\": \"" << quest->id << "\",\n";
-        oss << "      \"status\": " << static_cast<int>(quest->status) << ",\n";
+        oss << "      \"id\": \"" << quest.id << "\",\n";
+        oss << "      \"status\": " << quest.status << ",\n";
         oss << "      \"objectives\": [\n";
 
         bool firstObjective = true;
-        for (const auto& obj : quest->objectives) {
+        for (const auto& obj : quest.objectives) {
             if (!firstObjective) oss << ",\n";
             oss << "        {\n";
-            oss << "          \"type\": " << static_cast<int>(obj.type) << ",\n";
+            oss << "          \"type\": " << obj.type << ",\n";
             oss << "          \"currentAmount\": " << obj.currentAmount << ",\n";
             oss << "          \"targetAmount\": " << obj.targetAmount << ",\n";
-            oss << "          \"completed\": " << (obj.isCompleted ? "true" : "false") << "\n";
+            oss << "          \"completed\": " << (obj.completed ? "true" : "false") << "\n";
             oss << "        }";
             firstObjective = false;
         }
@@ -265,27 +1058,50 @@ std::string SaveSystem::serializePlayerState(const PlayerState& playerState) con
     oss << "\n  ],\n";
 
 
-    DialogueManager& dialogueMgr = DialogueManager::getInstance();
-    oss << "  \"dialogueHistory\": [\n";
-
-
+    oss << "  \"inventory\": [\n";
+    bool firstSlot = true;
+    for (const auto& item : snapshot.inventory) {
+        if (!firstSlot) oss << ",\n";
+        oss << "    { \"slot\": " << item.slot << ", \"count\": " << item.count
+            << ", \"name\": \"" << item.name << "\", \"value\": " << item.value
+            << ", \"weight\": " << item.weight << " }";
+        firstSlot = false;
+    }
+    oss << "\n  ],\n";
 
 
-    oss << "  ],\n";
+    oss << "  \"dialogueHistory\": [\n";
+    bool firstDialogue = true;
+    for (const auto& dialogue : snapshot.dialogueHistory) {
+        if (!firstDialogue) oss << ",\n";
+        oss << "    { \"dialogueId\": \"" << dialogue.dialogueId << "\", \"choices\": [";
+        bool firstChoice = true;
+        for (const auto& choice : dialogue.choices) {
+            oss << (firstChoice ? "" : ", ") << "\"" << choice << "\"";
+            firstChoice = false;
+        }
+        oss << "] }";
+        firstDialogue = false;
+    }
+    oss << "\n  ],\n";
+    oss << "  \"dialogueFlags\": [";
+    for (std::size_t i = 0; i < snapshot.dialogueFlags.size(); i++) {
+        oss << (i == 0 ? "" : ", ") << "\"" << snapshot.dialogueFlags[i] << "\"";
+    }
+    oss << "],\n";
 
 
-    NPCManager& npcMgr = NPCManager::getInstance();
     oss << "  \"npcs\": [\n";
     bool firstNPC = true;
-    for (const auto& npc : npcMgr.getTeam()) {
+    for (const auto& npc : snapshot.npcs) {
         if (!firstNPC) oss << ",\n";
         oss << "    {\n";
-        oss << "      \"id\": \"" << npc->getId() << "\",\n";
-        oss << "      \"name\": \"" << npc->getName() << "\",\n";
-        oss << "      \"level\": " << npc->getLevel() << ",\n";
-        oss << "      \"experience\": " << npc->getExperience() << ",\n";
-        oss << "      \"passiveAbilityId\": \"" << (npc->hasPassiveAbility() ? npc->getPassiveAbility().id : "") << "\",\n";
-        oss << "      \"activeAbilityId\": \"" << (npc->hasActiveAbility() ? npc->getActiveAbility().id : "") << "\"\n";
+        oss << "      \"id\": \"" << npc.id << "\",\n";
+        oss << "      \"name\": \"" << npc.name << "\",\n";
+        oss << "      \"level\": " << npc.level << ",\n";
+        oss << "      \"experience\": " << npc.experience << ",\n";
+        oss << "      \"passiveAbilityId\": \"" << npc.passiveAbilityId << "\",\n";
+        oss << "      \"activeAbilityId\": \"" << npc.activeAbilityId << "\"\n";
         oss << "    }";
         firstNPC = false;
     }
@@ -294,7 +1110,7 @@ std::string SaveSystem::serializePlayerState(const PlayerState& playerState) con
 
     oss << "  \"principles\": [\n";
     bool firstPrinciple = true;
-    for (const auto& principle : playerState.getPrinciples()) {
+    for (const auto& principle : snapshot.principles) {
         if (!firstPrinciple) oss << ",\n";
         oss << "    \"" << principle << "\"";
         firstPrinciple = false;
@@ -304,7 +1120,7 @@ std::string SaveSystem::serializePlayerState(const PlayerState& playerState) con
 
     oss << "  \"traits\": [\n";
     bool firstTrait = true;
-    for (const auto& trait : playerState.getTraits()) {
+    for (const auto& trait : snapshot.traits) {
         if (!firstTrait) oss << ",\n";
         oss << "    \"" << trait << "\"";
         firstTrait = false;
@@ -314,7 +1130,7 @@ std::string SaveSystem::serializePlayerState(const PlayerState& playerState) con
 
     oss << "  \"storyItems\": [\n";
     bool firstItem = true;
-    for (const auto& item : playerState.getStoryItems()) {
+    for (const auto& item : snapshot.storyItems) {
         if (!firstItem) oss << ",\n";
         oss << "    \"" << item << "\"";
         firstItem = false;
@@ -327,24 +1143,208 @@ std::string SaveSystem::serializePlayerState(const PlayerState& playerState) con
 }
 
 
-bool SaveSystem::deserializePlayerState(const std::string& data, PlayerState& playerState) const {
+bool SaveSystem::decodeSnapshot(const std::string& data, SaveSnapshot& snapshot) const {
+    if (SaveFormat::isBinary(data)) {
+        return decodeBinarySnapshot(data, snapshot);
+    }
+    return decodeTextSnapshot(data, snapshot);
+}
+
+
+bool SaveSystem::decodeBinarySnapshot(std::string_view data, SaveSnapshot& snapshot) const {
+    ProfileZone zone("SaveSystem::deserialize");
+
+    SaveFormat::File file;
+    if (!file.open(data)) {
+        std::cerr << "Corrupt binary save header" << std::endl;
+        return false;
+    }
+    snapshot.version = file.getVersion();
+
+    bool hasPlayer = false;
+    SaveFormat::Section section;
+    while (file.nextSection(section)) {
+        SaveFormat::Reader reader(section.body);
+
+        switch (section.tag) {
+        case SaveFormat::TAG_PLAYER:
+            snapshot.timestamp = static_cast<std::time_t>(reader.readI64());
+            snapshot.energy = reader.readF32();
+            snapshot.money = reader.readF32();
+            snapshot.fuel = reader.readF32();
+            snapshot.vehicleCondition = reader.readF32();
+            snapshot.mood = reader.readF32();
+            snapshot.reputation = reader.readI32();
+            snapshot.origin = reader.readI32();
+            snapshot.carType = reader.readI32();
+            snapshot.currentNodeId = reader.readI32();
+            snapshot.currentNotebookEntryId = std::string(reader.readString());
+            if (!reader.atEnd()) {
+                snapshot.playTime = reader.readF32();
+            }
+            hasPlayer = true;
+            break;
+
+        case SaveFormat::TAG_INVENTORY: {
+            snapshot.hasInventory = true;
+            snapshot.maxInventoryWeight = reader.readF32();
+            std::uint32_t count = reader.readCount(37);
+            snapshot.inventory.clear();
+            snapshot.inventory.reserve(count);
+            for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                SaveSnapshot::ItemState item;
+                item.slot = reader.readI32();
+                item.count = reader.readI32();
+                item.name = std::string(reader.readString());
+                item.description = std::string(reader.readString());
+                item.category = reader.readI32();
+                item.rarity = reader.readI32();
+                item.value = reader.readI32();
+                item.weight = reader.readF32();
+                item.stackable = reader.readBool();
+                item.maxStackSize = reader.readI32();
+                snapshot.inventory.push_back(std::move(item));
+            }
+            break;
+        }
+
+        case SaveFormat::TAG_EXPERIENCE: {
+            snapshot.level = reader.readI32();
+            snapshot.experience = reader.readI32();
+            std::uint32_t count = reader.readCount(4);
+            snapshot.unlockedAbilities.clear();
+            for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                snapshot.unlockedAbilities.emplace_back(reader.readString());
+            }
+            break;
+        }
+
+        case SaveFormat::TAG_QUESTS: {
+
+
+            std::map<std::string, std::size_t> existing;
+            for (std::size_t i = 0; i < snapshot.quests.size(); i++) {
+                existing[snapshot.quests[i].id] = i;
+            }
+
+            std::uint32_t count = reader.readCount(12);
+            for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                SaveSnapshot::QuestState quest;
+                quest.id = std::string(reader.readString());
+                quest.status = reader.readI32();
+                std::uint32_t objectiveCount = reader.readCount(13);
+                for (std::uint32_t j = 0; j < objectiveCount && reader.ok(); j++) {
+                    SaveSnapshot::ObjectiveState obj;
+                    obj.type = reader.readI32();
+                    obj.currentAmount = reader.readI32();
+                    obj.targetAmount = reader.readI32();
+                    obj.completed = reader.readBool();
+                    quest.objectives.push_back(obj);
+                }
+
+                auto it = existing.find(quest.id);
+                if (it != existing.end()) {
+                    snapshot.quests[it->second] = std::move(quest);
+                } else {
+                    snapshot.quests.push_back(std::move(quest));
+                }
+            }
+            break;
+        }
+
+        case SaveFormat::TAG_NPCS: {
+            std::uint32_t count = reader.readCount(24);
+            snapshot.npcs.clear();
+            snapshot.npcs.reserve(count);
+            for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                SaveSnapshot::NPCState npc;
+                npc.id = std::string(reader.readString());
+                npc.name = std::string(reader.readString());
+                npc.level = reader.readI32();
+                npc.experience = reader.readI32();
+                npc.passiveAbilityId = std::string(reader.readString());
+                npc.activeAbilityId = std::string(reader.readString());
+                snapshot.npcs.push_back(std::move(npc));
+            }
+            break;
+        }
+
+        case SaveFormat::TAG_DIALOGUE: {
+            snapshot.hasDialogueHistory = true;
+
+
+            std::map<std::string, std::size_t> existing;
+            for (std::size_t i = 0; i < snapshot.dialogueHistory.size(); i++) {
+                existing[snapshot.dialogueHistory[i].dialogueId] = i;
+            }
+
+            std::uint32_t count = reader.readCount(8);
+            for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                std::string dialogueId(reader.readString());
+                auto it = existing.find(dialogueId);
+                if (it == existing.end()) {
+                    it = existing.emplace(dialogueId, snapshot.dialogueHistory.size()).first;
+                    snapshot.dialogueHistory.push_back({dialogueId, {}});
+                }
+
+                auto& choices = snapshot.dialogueHistory[it->second].choices;
+                std::uint32_t choiceCount = reader.readCount(4);
+                for (std::uint32_t j = 0; j < choiceCount && reader.ok(); j++) {
+                    if (file.getVersion() < SaveFormat::FIRST_HASHED_DIALOGUE_VERSION) {
+                        choices.emplace_back(reader.readString());
+                    } else {
+                        choices.push_back(StringId::fromHash(reader.readU32()));
+                    }
+                }
+            }
 
+            if (!reader.atEnd()) {
+                std::uint32_t flagCount = reader.readCount(4);
+                for (std::uint32_t i = 0; i < flagCount && reader.ok(); i++) {
+                    snapshot.dialogueFlags.push_back(StringId::fromHash(reader.readU32()));
+                }
+            }
+            break;
+        }
 
+        case SaveFormat::TAG_FLAGS:
+            for (auto* list : {&snapshot.principles, &snapshot.traits, &snapshot.storyItems}) {
+                std::uint32_t count = reader.readCount(4);
+                for (std::uint32_t i = 0; i < count && reader.ok(); i++) {
+                    list->emplace_back(reader.readString());
+                }
+            }
+            break;
 
 
+        default:
+            break;
+        }
 
+        if (!reader.ok()) {
+            std::cerr << "Corrupt save section 0x" << std::hex << section.tag << std::dec << std::endl;
+            return false;
+        }
+    }
 
+    if (!file.isComplete() || !hasPlayer) {
+        std::cerr << "Binary save is missing sections" << std::endl;
+        return false;
+    }
+    return true;
+}
 
 
+bool SaveSystem::decodeTextSnapshot(const std::string& data, SaveSnapshot& snapshot) const {
+    ProfileZone zone("SaveSystem::deserializeText");
+
     std::istringstream iss(data);
     std::string line;
 
-    float energy = 0.0f, money = 0.0f, fuel = 0.0f;
-    float vehicleCondition = 100.0f, mood = 70.0f;
-    int origin = 0, carType = 0, currentNodeId = 0;
-    int reputation = 0;
-    std::string currentNotebookEntryId = "tutorial_start";
-    std::vector<std::string> principles, traits, storyItems;
+    snapshot.version = SaveFormat::TEXT_VERSION;
+    snapshot.vehicleCondition = 100.0f;
+    snapshot.mood = 70.0f;
+    snapshot.currentNotebookEntryId = "tutorial_start";
     std::string currentArray = "";
 
     while (std::getline(iss, line)) {
@@ -382,11 +1382,11 @@ bool SaveSystem::deserializePlayerState(const std::string& data, PlayerState& pl
                 if (secondQuote != std::string::npos) {
                     std::string value = line.substr(firstQuote + 1, secondQuote - firstQuote - 1);
                     if (currentArray == "principles") {
-                        principles.push_back(value);
+                        snapshot.principles.push_back(value);
                     } else if (currentArray == "traits") {
-                        traits.push_back(value);
+                        snapshot.traits.push_back(value);
                     } else if (currentArray == "storyItems") {
-                        storyItems.push_back(value);
+                        snapshot.storyItems.push_back(value);
                     }
                 }
             }
@@ -412,75 +1412,200 @@ bool SaveSystem::deserializePlayerState(const std::string& data, PlayerState& pl
         value.erase(value.find_last_not_of(" \t,") + 1);
 
 
-        if (key == "energy") {
-            energy = std::stof(value);
+        if (key == "version") {
+            snapshot.version = static_cast<std::uint32_t>(std::stoul(value));
+        } else if (key == "timestamp") {
+            snapshot.timestamp = static_cast<std::time_t>(std::stoll(value));
+        } else if (key == "playTime") {
+            snapshot.playTime = std::stof(value);
+        } else if (key == "energy") {
+            snapshot.energy = std::stof(value);
         } else if (key == "money") {
-            money = std::stof(value);
+            snapshot.money = std::stof(value);
         } else if (key == "fuel") {
-            fuel = std::stof(value);
+            snapshot.fuel = std::stof(value);
         } else if (key == "vehicleCondition") {
-            vehicleCondition = std::stof(value);
+            snapshot.vehicleCondition = std::stof(value);
         } else if (key == "mood") {
-            mood = std::stof(value);
+            snapshot.mood = std::stof(value);
         } else if (key == "reputation") {
-            reputation = std::stoi(value);
+            snapshot.reputation = std::stoi(value);
         } else if (key == "origin") {
-            origin = std::stoi(value);
+            snapshot.origin = std::stoi(value);
         } else if (key == "carType") {
-            carType = std::stoi(value);
+            snapshot.carType = std::stoi(value);
         } else if (key == "currentNodeId") {
-            currentNodeId = std::stoi(value);
+            snapshot.currentNodeId = std::stoi(value);
         } else if (key == "currentNotebookEntryId") {
 
             value.erase(0, value.find_first_not_of("\""));
             value.erase(value.find_last_not_of("\"") + 1);
-            currentNotebookEntryId = value;
+            snapshot.currentNotebookEntryId = value;
         }
-
-
     }
 
+    return true;
+}
+
 
-    playerState.setEnergy(energy);
-    playerState.setMoney(money);
-    playerState.setFuel(fuel);
-    playerState.setVehicleCondition(vehicleCondition);
-    playerState.setMood(mood);
-    playerState.setReputation(reputation);
-    playerState.setOrigin(static_cast<OriginType>(origin));
-    playerState.setCarType(static_cast<CarType>(carType));
-    playerState.setCurrentNodeId(currentNodeId);
-    playerState.setCurrentNotebookEntryId(currentNotebookEntryId);
+void SaveSystem::applySnapshot(const SaveSnapshot& snapshot, PlayerState& playerState) const {
+    playerState.setEnergy(snapshot.energy);
+    playerState.setMoney(snapshot.money);
+    playerState.setFuel(snapshot.fuel);
+    playerState.setVehicleCondition(snapshot.vehicleCondition);
+    playerState.setMood(snapshot.mood);
+    playerState.setReputation(snapshot.reputation);
+    playerState.setOrigin(static_cast<OriginType>(snapshot.origin));
+    playerState.setCarType(static_cast<CarType>(snapshot.carType));
+    playerState.setCurrentNodeId(snapshot.currentNodeId);
+    playerState.setCurrentNotebookEntryId(snapshot.currentNotebookEntryId);
+    playerState.resetPlayTime();
+    playerState.updatePlayTime(snapshot.playTime);
 
 
-    for (const auto& principle : principles) {
+    for (const auto& principle : snapshot.principles) {
         playerState.addPrinciple(principle);
     }
-    for (const auto& trait : traits) {
+    for (const auto& trait : snapshot.traits) {
         playerState.addTrait(trait);
     }
-    for (const auto& item : storyItems) {
+    for (const auto& item : snapshot.storyItems) {
         playerState.addStoryItem(item);
     }
 
+
+
+    if (snapshot.hasInventory) {
+        InventorySystem& inventory = playerState.getInventory();
+        inventory.clear();
+        inventory.setMaxWeight(snapshot.maxInventoryWeight);
+        for (const auto& state : snapshot.inventory) {
+            if (state.slot < 0 || state.slot >= inventory.getSlotCount() || state.count <= 0) {
+                continue;
+            }
+
+            Item item(state.name, state.description, static_cast<ItemCategory>(state.category),
+                      static_cast<ItemRarity>(state.rarity), state.value, state.weight,
+                      state.stackable, state.maxStackSize);
+            inventory.setSlot(state.slot, item, state.count);
+        }
+    }
+
+    if (snapshot.hasDialogueHistory) {
+        DialogueManager& dialogueManager = DialogueManager::getInstance();
+        dialogueManager.clearHistory();
+        dialogueManager.clearFlags();
+        for (const auto& dialogue : snapshot.dialogueHistory) {
+            StringId dialogueId(dialogue.dialogueId);
+            for (StringId choice : dialogue.choices) {
+                dialogueManager.addToHistory(dialogueId, choice);
+            }
+        }
+        for (StringId flag : snapshot.dialogueFlags) {
+            dialogueManager.setFlag(flag);
+        }
+    }
+}
+
+
+bool SaveSystem::writeToFile(const std::string& filename, const std::string& data,
+                             const std::string& metadata) {
+
+
+
+    char header[SAVE_HEADER_MAX];
+    std::snprintf(header, sizeof(header), "%s %08x %zu %zu\n", SAVE_HEADER_TAG,
+                  static_cast<unsigned int>(crc32(data)), data.size(), metadata.size());
+    return writeFileAtomically(filename, header + metadata + data);
+}
+
+
+bool SaveSystem::readVerified(const std::string& filename, std::string& payload) const {
+    std::string contents = readFromFile(filename);
+    if (contents.empty()) {
+        std::cerr << "Failed to read " << filename << std::endl;
+        return false;
+    }
+
+
+    if (contents.compare(0, sizeof(SAVE_HEADER_TAG) - 1, SAVE_HEADER_TAG) != 0) {
+        std::cerr << "Warning: " << filename << " has no checksum, loading unverified" << std::endl;
+        payload = std::move(contents);
+        return true;
+    }
+
+    std::size_t headerEnd = contents.find('\n');
+    unsigned int expectedCrc = 0;
+    std::size_t expectedSize = 0;
+    std::size_t metadataSize = 0;
+    if (headerEnd == std::string::npos ||
+        std::sscanf(contents.substr(0, headerEnd).c_str() + sizeof(SAVE_HEADER_TAG) - 1, " %8x %zu %zu",
+                    &expectedCrc, &expectedSize, &metadataSize) < 2 ||
+        contents.size() - headerEnd - 1 < metadataSize) {
+        std::cerr << "Corrupt save header in " << filename << std::endl;
+        return false;
+    }
+
+    payload = contents.substr(headerEnd + 1 + metadataSize);
+    if (payload.size() != expectedSize) {
+        std::cerr << "Truncated save " << filename << ": expected " << expectedSize
+                  << " bytes, found " << payload.size() << std::endl;
+        return false;
+    }
+    if (crc32(payload) != expectedCrc) {
+        std::cerr << "Checksum mismatch in " << filename << std::endl;
+        return false;
+    }
     return true;
 }
 
 
-bool SaveSystem::writeToFile(const std::string& filename, const std::string& data) {
-    std::ofstream file(filename);
+bool SaveSystem::readMetadata(const std::string& filename, SaveFormat::SlotMetadata& metadata) const {
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
 
-    file << data;
-    file.close();
-    return true;
+
+    std::string prefix(SAVE_HEADER_MAX + SaveFormat::METADATA_SIZE, '\0');
+    file.read(&prefix[0], static_cast<std::streamsize>(prefix.size()));
+    prefix.resize(static_cast<std::size_t>(file.gcount()));
+
+    std::size_t headerEnd = prefix.find('\n');
+    if (prefix.compare(0, sizeof(SAVE_HEADER_TAG) - 1, SAVE_HEADER_TAG) != 0 ||
+        headerEnd == std::string::npos) {
+        return false;
+    }
+
+    unsigned int crc = 0;
+    std::size_t payloadSize = 0;
+    std::size_t metadataSize = 0;
+    int fields = std::sscanf(prefix.substr(0, headerEnd).c_str() + sizeof(SAVE_HEADER_TAG) - 1, " %8x %zu %zu",
+                             &crc, &payloadSize, &metadataSize);
+    if (fields < 2) {
+        return false;
+    }
+
+
+
+    if (filename == getSaveFilePath()) {
+        std::string sidecar = readFromFile(getMetadataFilePath());
+        if (sidecar.size() == 4 + SaveFormat::METADATA_SIZE && SaveFormat::loadU32(sidecar.data()) == crc &&
+            SaveFormat::decodeMetadata(std::string_view(sidecar).substr(4), metadata)) {
+            return true;
+        }
+    }
+
+    if (fields != 3 || metadataSize < SaveFormat::METADATA_SIZE) {
+        return false;
+    }
+
+    return SaveFormat::decodeMetadata(std::string_view(prefix).substr(headerEnd + 1), metadata);
 }
 
 
 std::string SaveSystem::readFromFile(const std::string& filename) const {
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return "";
     }
@@ -511,9 +1636,19 @@ void SaveSystem::rotateBackups() {
     }
 
 
+
+
     if (hasSaveFile()) {
-        std::string data = readFromFile(getSaveFilePath());
-        writeToFile(getBackupFilePath(0), data);
+        std::string savePath = getSaveFilePath();
+        std::string backupPath = getBackupFilePath(0);
+#ifndef _WIN32
+        if (::link(savePath.c_str(), backupPath.c_str()) == 0) {
+            return;
+        }
+#endif
+        std::ifstream source(savePath, std::ios::binary);
+        std::ofstream target(backupPath, std::ios::binary | std::ios::trunc);
+        target << source.rdbuf();
     }
 }
 
@@ -526,3 +1661,18 @@ std::string SaveSystem::getSaveFilePath() const {
 std::string SaveSystem::getBackupFilePath(int index) const {
     return m_saveDirectory + "/savegame_backup_" + std::to_string(index) + ".sav";
 }
+
+
+std::string SaveSystem::getDebugTextFilePath() const {
+    return m_saveDirectory + "/savegame_debug.txt";
+}
+
+
+std::string SaveSystem::getJournalFilePath() const {
+    return m_saveDirectory + "/savegame.journal";
+}
+
+
+std::string SaveSystem::getMetadataFilePath() const {
+    return m_saveDirectory + "/savegame.meta";
+}
@@ -9,13 +9,21 @@
 #include "Notebook/NotebookScene.h"
 #include "GameStateManager.h"
 #include "EventHelper.h"
+#include "EventBus.h"
+#include "Profiler.h"
+#include <chrono>
 #include <stdexcept>
 #include <iostream>
 
 
 SceneManager::SceneManager(sf::RenderWindow& window)
     : m_window(window),
-      m_currentSceneType(SceneType::MAIN_MENU) {
+      m_currentSceneType(SceneType::MAIN_MENU),
+      m_frameDuration(sf::Time::Zero),
+      m_verticalSync(false),
+      m_idleTimeout(sf::milliseconds(250)),
+      m_preloadType(SceneType::EXIT),
+      m_profilingBeforeOverlay(false) {
 
 
     m_currentScene = createScene(SceneType::MAIN_MENU);
@@ -27,6 +35,70 @@ SceneManager::SceneManager(sf::RenderWindow& window)
 
 
 std::unique_ptr<Scene> SceneManager::createScene(SceneType type) {
+    std::unique_ptr<Scene> scene = takePreloadedScene(type);
+    if (!scene) {
+        scene = buildScene(type, &GameStateManager::getInstance().getPlayerState());
+    }
+
+    if (scene) {
+        scene->onEnter();
+        preloadScene(predictNextScene(type));
+    }
+    return scene;
+}
+
+
+SceneType SceneManager::predictNextScene(SceneType current) {
+    switch (current) {
+        case SceneType::MAIN_MENU:
+            return SceneType::NOTEBOOK;
+        default:
+            return SceneType::EXIT;
+    }
+}
+
+
+void SceneManager::preloadScene(SceneType type) {
+    if (type == SceneType::EXIT || m_preload.valid()) {
+        return;
+    }
+
+    m_preloadType = type;
+    PlayerState* playerState = &GameStateManager::getInstance().getPlayerState();
+
+
+
+
+    std::cout << "[SceneManager] Preloading scene in background" << std::endl;
+    m_preload = std::async(std::launch::async, [type, playerState]() {
+        return buildScene(type, playerState);
+    });
+}
+
+
+bool SceneManager::isSceneLoading(SceneType type) const {
+    return m_preload.valid() && m_preloadType == type &&
+           m_preload.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+
+std::unique_ptr<Scene> SceneManager::takePreloadedScene(SceneType type) {
+    if (!m_preload.valid() || m_preloadType != type) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Scene> scene;
+    try {
+        scene = m_preload.get();
+    } catch (const std::exception& e) {
+        std::cerr << "[SceneManager] Background scene load failed: " << e.what() << std::endl;
+        return nullptr;
+    }
+    return scene;
+}
+
+
+std::unique_ptr<Scene> SceneManager::buildScene(SceneType type, PlayerState* playerState) {
     switch (type) {
         case SceneType::MAIN_MENU:
             std::cout << "Creating Main Menu Scene" << std::endl;
@@ -53,18 +125,9 @@ std::unique_ptr<Scene> SceneManager::createScene(SceneType type) {
 
 
 
-        case SceneType::NOTEBOOK: {
+        case SceneType::NOTEBOOK:
             std::cout << "Creating Notebook Scene" << std::endl;
-
-            auto& playerState = GameStateManager::getInstance().getPlayerState();
-
-            std::string entryId = playerState.getCurrentNotebookEntryId();
-            if (entryId.empty()) {
-                entryId = "tutorial_start";
-            }
-            std::cout << "[SceneManager] Loading notebook entry: " << entryId << std::endl;
-            return std::make_unique<NotebookScene>(&playerState, entryId);
-        }
+            return std::make_unique<NotebookScene>(playerState);
 
         case SceneType::EXIT:
             std::cout << "Exit requested" << std::endl;
@@ -82,10 +145,69 @@ std::unique_ptr<Scene> SceneManager::createScene(SceneType type) {
 }
 
 
+void SceneManager::setFrameRateLimit(unsigned int framesPerSecond) {
+    m_frameDuration = framesPerSecond > 0 ? sf::seconds(1.0f / static_cast<float>(framesPerSecond))
+                                          : sf::Time::Zero;
+}
+
+void SceneManager::setVerticalSyncEnabled(bool enabled) {
+    m_verticalSync = enabled;
+    m_window.setVerticalSyncEnabled(enabled);
+}
+
+bool SceneManager::dispatchEvent(const sf::Event& event) {
+    if (EventHelper::isClosed(event)) {
+        m_window.close();
+        return false;
+    }
+
+
+    if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        if (keyPressed->code == sf::Keyboard::Key::F3) {
+            Profiler& profiler = Profiler::getInstance();
+            m_profilerOverlay.toggle();
+            if (m_profilerOverlay.isVisible()) {
+                m_profilingBeforeOverlay = profiler.isEnabled();
+                profiler.setEnabled(true);
+            } else {
+                profiler.setEnabled(m_profilingBeforeOverlay);
+            }
+            return true;
+        }
+        if (keyPressed->code == sf::Keyboard::Key::F4) {
+            Profiler::getInstance().dumpChromeTrace("profile_trace.json");
+            return true;
+        }
+    }
+
+
+    if (!m_currentScene->isFinished()) {
+        m_currentScene->handleInput(event);
+    }
+    return true;
+}
+
 void SceneManager::run() {
     sf::Clock clock;
+    sf::Clock frameClock;
+    Profiler& profiler = Profiler::getInstance();
+    bool needsRedraw = true;
 
     while (m_window.isOpen() && m_currentScene) {
+
+
+
+        if (!needsRedraw && !m_profilerOverlay.isVisible() && m_currentScene->isIdle()) {
+            if (const std::optional<sf::Event> event = m_window.waitEvent(m_idleTimeout)) {
+                if (!dispatchEvent(*event)) {
+                    return;
+                }
+                needsRedraw = true;
+            }
+        }
+
+        frameClock.restart();
+        profiler.beginFrame();
         float deltaTime = clock.restart().asSeconds();
 
 
@@ -93,18 +215,31 @@ void SceneManager::run() {
         playerState.updatePlayTime(deltaTime);
 
 
-        while (const std::optional<sf::Event> event = m_window.pollEvent()) {
-            if (EventHelper::isClosed(*event)) {
-                m_window.close();
-                return;
+        {
+            ProfileZone zone("SceneManager::pollEvents");
+            while (const std::optional<sf::Event> event = m_window.pollEvent()) {
+                if (!dispatchEvent(*event)) {
+                    return;
+                }
+                needsRedraw = true;
             }
+        }
 
 
-            m_currentScene->handleInput(*event);
+        {
+            ProfileZone zone("EventBus::processQueue");
+            EventBus::getInstance().processQueue();
         }
 
 
-        m_currentScene->update(deltaTime);
+
+        if (!m_currentScene->isIdle() || m_profilerOverlay.isVisible()) {
+            needsRedraw = true;
+        }
+        {
+            ProfileZone zone("Scene::update");
+            m_currentScene->update(deltaTime);
+        }
 
 
         if (m_currentScene->isFinished()) {
@@ -117,19 +252,47 @@ void SceneManager::run() {
             }
 
 
-            m_currentSceneType = nextSceneType;
-            m_currentScene = createScene(nextSceneType);
 
-            if (!m_currentScene) {
 
-                m_window.close();
-                return;
+
+            if (!isSceneLoading(nextSceneType)) {
+                ProfileZone zone("SceneManager::createScene");
+                m_currentSceneType = nextSceneType;
+                m_currentScene = createScene(nextSceneType);
+
+                if (!m_currentScene) {
+
+                    m_window.close();
+                    return;
+                }
+                needsRedraw = true;
             }
         }
 
+        if (!needsRedraw) {
+            profiler.endFrame();
+            continue;
+        }
 
         m_window.clear();
-        m_currentScene->render(m_window);
-        m_window.display();
+        {
+            ProfileZone zone("Scene::render");
+            m_currentScene->render(m_window);
+        }
+        m_profilerOverlay.render(m_window);
+        {
+            ProfileZone zone("SceneManager::display");
+            m_window.display();
+        }
+        needsRedraw = false;
+        profiler.endFrame();
+
+
+        if (!m_verticalSync && m_frameDuration > sf::Time::Zero) {
+            sf::Time elapsed = frameClock.getElapsedTime();
+            if (elapsed < m_frameDuration) {
+                sf::sleep(m_frameDuration - elapsed);
+            }
+        }
     }
 }
@@ -0,0 +1,99 @@
+#include "StringId.h"
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace {
+
+struct SymbolTable {
+    std::mutex mutex;
+    std::unordered_map<std::uint32_t, std::string> names;
+};
+
+SymbolTable& getSymbolTable() {
+    static SymbolTable table;
+    return table;
+}
+
+
+
+
+
+
+using LocalNames = std::unordered_map<std::uint32_t, const std::string*>;
+
+LocalNames& getLocalNames() {
+    thread_local LocalNames names;
+    return names;
+}
+
+std::atomic<std::size_t> internErrors{0};
+
+}
+
+
+StringId::StringId(std::string_view name)
+    : m_hash(StringIdHash::fnv1a(name.data(), name.size())) {
+    if (m_hash == 0) {
+        if (!name.empty()) {
+            std::cerr << "[StringId] \"" << name << "\" hashes to the invalid id" << std::endl;
+            internErrors++;
+        }
+        return;
+    }
+
+    LocalNames& local = getLocalNames();
+    auto known = local.find(m_hash);
+    if (known != local.end()) {
+        if (*known->second != name) {
+            std::cerr << "[StringId] Hash collision between \"" << *known->second
+                      << "\" and \"" << name << "\"" << std::endl;
+            internErrors++;
+        }
+        return;
+    }
+
+    SymbolTable& table = getSymbolTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.names.find(m_hash);
+    if (it == table.names.end()) {
+        it = table.names.emplace(m_hash, std::string(name)).first;
+    } else if (it->second != name) {
+        std::cerr << "[StringId] Hash collision between \"" << it->second
+                  << "\" and \"" << name << "\"" << std::endl;
+        internErrors++;
+    }
+    local.emplace(m_hash, &it->second);
+}
+
+
+std::size_t StringId::getInternErrorCount() {
+    return internErrors.load();
+}
+
+
+const std::string& StringId::str() const {
+    static const std::string empty;
+    if (m_hash == 0) {
+        return empty;
+    }
+
+    LocalNames& local = getLocalNames();
+    auto known = local.find(m_hash);
+    if (known != local.end()) {
+        return *known->second;
+    }
+
+    SymbolTable& table = getSymbolTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.names.find(m_hash);
+    if (it == table.names.end()) {
+        return empty;
+    }
+    local.emplace(m_hash, &it->second);
+    return it->second;
+}
@@ -3,10 +3,70 @@
 #include <iomanip>
 #include <iostream>
 
+namespace {
+
+// Height of the bottom panel and the space kept above it for section labels
+constexpr float HUD_HEIGHT = 120.f;
+constexpr float LABEL_MARGIN = 20.f;
+
+// Append an axis-aligned rectangle as two triangles
+void appendQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    sf::Vector2f topRight(position.x + size.x, position.y);
+    sf::Vector2f bottomLeft(position.x, position.y + size.y);
+    sf::Vector2f bottomRight(position.x + size.x, position.y + size.y);
+
+    vertices.append(sf::Vertex{position, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{topRight, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomLeft, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomLeft, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{topRight, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomRight, color, sf::Vector2f()});
+}
+
+// Append a rectangle shape the way SFML draws it: fill first, then an
+// outline that grows outwards from the shape's edges
+void appendShape(sf::VertexArray& vertices, const sf::RectangleShape& shape) {
+    sf::Vector2f position = shape.getPosition();
+    sf::Vector2f size = shape.getSize();
+    appendQuad(vertices, position, size, shape.getFillColor());
+
+    float thickness = shape.getOutlineThickness();
+    if (thickness <= 0.f) {
+        return;
+    }
+
+    sf::Color outline = shape.getOutlineColor();
+    float outerWidth = size.x + thickness * 2.f;
+    appendQuad(vertices, sf::Vector2f(position.x - thickness, position.y - thickness),
+               sf::Vector2f(outerWidth, thickness), outline);
+    appendQuad(vertices, sf::Vector2f(position.x - thickness, position.y + size.y),
+               sf::Vector2f(outerWidth, thickness), outline);
+    appendQuad(vertices, sf::Vector2f(position.x - thickness, position.y),
+               sf::Vector2f(thickness, size.y), outline);
+    appendQuad(vertices, sf::Vector2f(position.x + size.x, position.y),
+               sf::Vector2f(thickness, size.y), outline);
+}
+
+// The layer is cleared to transparent and drawn into with regular alpha
+// blending, which leaves it holding premultiplied colour. It must therefore
+// be blended onto the window with One rather than SrcAlpha.
+sf::RenderStates premultipliedStates() {
+    sf::RenderStates states;
+    states.blendMode = sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+    return states;
+}
+
+}
+
 HUDPanel::HUDPanel(float windowWidth, float windowHeight)
     : m_windowWidth(windowWidth),
       m_windowHeight(windowHeight),
       m_fontLoaded(false),
+      m_chromeVertices(sf::PrimitiveType::Triangles),
+      m_dynamicVertices(sf::PrimitiveType::Triangles),
+      m_layerTop(0.0f),
+      m_layerReady(false),
+      m_layerDirty(true),
       m_topRightEnabled(true),
       m_topRightMoney(0.0f),
       m_topRightFuelCurrent(100.0f),
@@ -41,6 +101,12 @@ void HUDPanel::initializeLayout() {
     initializeLeftSection();
     initializeCenterSection();
     initializeRightSection();
+
+    // Chrome never changes after layout; values are pushed through once so
+    // the labels and dynamic geometry match the current data
+    buildChromeVertices();
+    initializeLayer();
+    applyData(m_data, true);
 }
 
 void HUDPanel::initializeLeftSection() {
@@ -230,29 +296,86 @@ void HUDPanel::initializeRightSection() {
 }
 
 void HUDPanel::update(const HUDData& data) {
+    applyData(data, false);
+}
+
+void HUDPanel::applyData(const HUDData& data, bool force) {
+    // Only values that actually differ touch text or geometry
+    const bool energyChanged = force || data.energy != m_data.energy;
+    const bool moneyChanged = force || data.money != m_data.money;
+    const bool inventoryChanged = force || data.inventoryWeight != m_data.inventoryWeight ||
+                                  data.maxInventoryWeight != m_data.maxInventoryWeight;
+    const bool speedChanged = force || data.speed != m_data.speed;
+    const bool odometerChanged = force || data.odometer != m_data.odometer;
+    const bool lcdChanged = force || data.lcdText != m_data.lcdText;
+    const bool fuelChanged = force || data.fuel != m_data.fuel;
+    const bool tempChanged = force || data.temperature != m_data.temperature;
+    const bool warningsChanged = force || data.engineWarning != m_data.engineWarning ||
+                                 data.fuelWarning != m_data.fuelWarning ||
+                                 data.checkEngine != m_data.checkEngine;
+
+    if (!energyChanged && !moneyChanged && !inventoryChanged && !speedChanged &&
+        !odometerChanged && !lcdChanged && !fuelChanged && !tempChanged && !warningsChanged) {
+        return;
+    }
+
     m_data = data;
-    updateBars();
+    m_layerDirty = true;
+
+    if (energyChanged || fuelChanged || tempChanged) {
+        updateBars();
+    }
+
+    if (warningsChanged) {
+        if (m_data.engineWarning) {
+            m_warningEngine.setFillColor(sf::Color(200, 50, 50));
+            if (m_warningEngineText) m_warningEngineText->setFillColor(sf::Color::White);
+        } else {
+            m_warningEngine.setFillColor(sf::Color(60, 40, 40));
+            if (m_warningEngineText) m_warningEngineText->setFillColor(sf::Color(150, 100, 100));
+        }
+
+        if (m_data.fuelWarning) {
+            m_warningFuel.setFillColor(sf::Color(200, 150, 50));
+            if (m_warningFuelText) m_warningFuelText->setFillColor(sf::Color::White);
+        } else {
+            m_warningFuel.setFillColor(sf::Color(60, 50, 40));
+            if (m_warningFuelText) m_warningFuelText->setFillColor(sf::Color(200, 150, 100));
+        }
+
+        if (m_data.checkEngine) {
+            m_warningCheck.setFillColor(sf::Color(200, 200, 50));
+            if (m_warningCheckText) m_warningCheckText->setFillColor(sf::Color::White);
+        } else {
+            m_warningCheck.setFillColor(sf::Color(60, 60, 40));
+            if (m_warningCheckText) m_warningCheckText->setFillColor(sf::Color(200, 200, 100));
+        }
+    }
+
+    if (energyChanged || fuelChanged || tempChanged || warningsChanged) {
+        buildDynamicVertices();
+    }
 
     if (!m_fontLoaded) {
         return;
     }
 
 
-    if (m_energyValue) {
+    if (energyChanged && m_energyValue) {
         std::ostringstream energyStream;
         energyStream << std::fixed << std::setprecision(0) << m_data.energy << "%";
         m_energyValue->setString(energyStream.str());
     }
 
 
-    if (m_moneyValue) {
+    if (moneyChanged && m_moneyValue) {
         std::ostringstream moneyStream;
         moneyStream << std::fixed << std::setprecision(0) << m_data.money << " ₽";
         m_moneyValue->setString(moneyStream.str());
     }
 
 
-    if (m_inventoryValue) {
+    if (inventoryChanged && m_inventoryValue) {
         std::ostringstream invStream;
         invStream << std::fixed << std::setprecision(1) << m_data.inventoryWeight
                   << "/" << m_data.maxInventoryWeight;
@@ -260,62 +383,37 @@ void HUDPanel::update(const HUDData& data) {
     }
 
 
-    if (m_speedValue) {
+    if (speedChanged && m_speedValue) {
         std::ostringstream speedStream;
         speedStream << std::fixed << std::setprecision(0) << m_data.speed;
         m_speedValue->setString(speedStream.str());
     }
 
 
-    if (m_odometerValue) {
+    if (odometerChanged && m_odometerValue) {
         std::ostringstream odoStream;
         odoStream << std::fixed << std::setprecision(1) << m_data.odometer << " км";
         m_odometerValue->setString(odoStream.str());
     }
 
 
-    if (m_lcdText) {
+    if (lcdChanged && m_lcdText) {
         m_lcdText->setString(m_data.lcdText);
     }
 
 
-    if (m_fuelValue) {
+    if (fuelChanged && m_fuelValue) {
         std::ostringstream fuelStream;
         fuelStream << std::fixed << std::setprecision(0) << m_data.fuel << "%";
         m_fuelValue->setString(fuelStream.str());
     }
 
 
-    if (m_tempValue) {
+    if (tempChanged && m_tempValue) {
         std::ostringstream tempStream;
         tempStream << std::fixed << std::setprecision(0) << m_data.temperature << "%";
         m_tempValue->setString(tempStream.str());
     }
-
-
-    if (m_data.engineWarning) {
-        m_warningEngine.setFillColor(sf::Color(200, 50, 50));
-        if (m_warningEngineText) m_warningEngineText->setFillColor(sf::Color::White);
-    } else {
-        m_warningEngine.setFillColor(sf::Color(60, 40, 40));
-        if (m_warningEngineText) m_warningEngineText->setFillColor(sf::Color(150, 100, 100));
-    }
-
-    if (m_data.fuelWarning) {
-        m_warningFuel.setFillColor(sf::Color(200, 150, 50));
-        if (m_warningFuelText) m_warningFuelText->setFillColor(sf::Color::White);
-    } else {
-        m_warningFuel.setFillColor(sf::Color(60, 50, 40));
-        if (m_warningFuelText) m_warningFuelText->setFillColor(sf::Color(200, 150, 100));
-    }
-
-    if (m_data.checkEngine) {
-        m_warningCheck.setFillColor(sf::Color(200, 200, 50));
-        if (m_warningCheckText) m_warningCheckText->setFillColor(sf::Color::White);
-    } else {
-        m_warningCheck.setFillColor(sf::Color(60, 60, 40));
-        if (m_warningCheckText) m_warningCheckText->setFillColor(sf::Color(200, 200, 100));
-    }
 }
 
 void HUDPanel::updateBars() {
@@ -359,55 +457,106 @@ void HUDPanel::updateBars() {
     }
 }
 
-void HUDPanel::render(sf::RenderWindow& window) {
+void HUDPanel::buildChromeVertices() {
+    m_chromeVertices.clear();
 
-    window.draw(m_hudBackground);
+    appendShape(m_chromeVertices, m_hudBackground);
 
+    appendShape(m_chromeVertices, m_energyPanel);
+    appendShape(m_chromeVertices, m_moneyPanel);
+    appendShape(m_chromeVertices, m_inventoryPanel);
 
-    window.draw(m_energyPanel);
-    window.draw(m_energyBar);
-    window.draw(m_moneyPanel);
-    window.draw(m_inventoryPanel);
+    appendShape(m_chromeVertices, m_speedPanel);
+    appendShape(m_chromeVertices, m_odometerPanel);
+    appendShape(m_chromeVertices, m_lcdPanel);
 
-    if (m_fontLoaded) {
-        if (m_energyText) window.draw(*m_energyText);
-        if (m_energyValue) window.draw(*m_energyValue);
-        if (m_moneyText) window.draw(*m_moneyText);
-        if (m_moneyValue) window.draw(*m_moneyValue);
-        if (m_inventoryText) window.draw(*m_inventoryText);
-        if (m_inventoryValue) window.draw(*m_inventoryValue);
+    appendShape(m_chromeVertices, m_fuelPanel);
+    appendShape(m_chromeVertices, m_tempPanel);
+}
+
+void HUDPanel::buildDynamicVertices() {
+    m_dynamicVertices.clear();
+
+    appendShape(m_dynamicVertices, m_energyBar);
+    appendShape(m_dynamicVertices, m_fuelBar);
+    appendShape(m_dynamicVertices, m_tempBar);
+
+    appendShape(m_dynamicVertices, m_warningEngine);
+    appendShape(m_dynamicVertices, m_warningFuel);
+    appendShape(m_dynamicVertices, m_warningCheck);
+}
+
+void HUDPanel::initializeLayer() {
+    m_layerTop = m_windowHeight - HUD_HEIGHT - LABEL_MARGIN;
+    m_layerDirty = true;
+
+    sf::Vector2u size(static_cast<unsigned int>(m_windowWidth),
+                      static_cast<unsigned int>(HUD_HEIGHT + LABEL_MARGIN));
+    if (m_layerReady && m_layer.getSize() == size) {
+        return;
     }
 
+    m_layerReady = m_layer.resize(size);
+    if (!m_layerReady) {
+        // Fall back to drawing the cached vertex arrays straight to the window
+        std::cerr << "Warning: Could not create HUD render texture" << std::endl;
+        m_layerSprite.reset();
+        return;
+    }
 
-    window.draw(m_speedPanel);
-    window.draw(m_odometerPanel);
-    window.draw(m_lcdPanel);
+    m_layerSprite.emplace(m_layer.getTexture());
+    m_layerSprite->setPosition(sf::Vector2f(0.f, m_layerTop));
+}
 
-    if (m_fontLoaded) {
-        if (m_speedText) window.draw(*m_speedText);
-        if (m_speedValue) window.draw(*m_speedValue);
-        if (m_odometerText) window.draw(*m_odometerText);
-        if (m_odometerValue) window.draw(*m_odometerValue);
-        if (m_lcdText) window.draw(*m_lcdText);
+void HUDPanel::drawPanel(sf::RenderTarget& target) const {
+    target.draw(m_chromeVertices);
+    target.draw(m_dynamicVertices);
+
+    if (!m_fontLoaded) {
+        return;
     }
 
+    if (m_energyText) target.draw(*m_energyText);
+    if (m_energyValue) target.draw(*m_energyValue);
+    if (m_moneyText) target.draw(*m_moneyText);
+    if (m_moneyValue) target.draw(*m_moneyValue);
+    if (m_inventoryText) target.draw(*m_inventoryText);
+    if (m_inventoryValue) target.draw(*m_inventoryValue);
+
+    if (m_speedText) target.draw(*m_speedText);
+    if (m_speedValue) target.draw(*m_speedValue);
+    if (m_odometerText) target.draw(*m_odometerText);
+    if (m_odometerValue) target.draw(*m_odometerValue);
+    if (m_lcdText) target.draw(*m_lcdText);
+
+    if (m_fuelText) target.draw(*m_fuelText);
+    if (m_fuelValue) target.draw(*m_fuelValue);
+    if (m_tempText) target.draw(*m_tempText);
+    if (m_tempValue) target.draw(*m_tempValue);
+    if (m_warningEngineText) target.draw(*m_warningEngineText);
+    if (m_warningFuelText) target.draw(*m_warningFuelText);
+    if (m_warningCheckText) target.draw(*m_warningCheckText);
+}
 
-    window.draw(m_fuelPanel);
-    window.draw(m_fuelBar);
-    window.draw(m_tempPanel);
-    window.draw(m_tempBar);
-    window.draw(m_warningEngine);
-    window.draw(m_warningFuel);
-    window.draw(m_warningCheck);
+void HUDPanel::composeLayer() {
+    // The layer's view maps window coordinates, so the layout is drawn unchanged
+    m_layer.setView(sf::View(sf::FloatRect(sf::Vector2f(0.f, m_layerTop),
+                                           sf::Vector2f(m_windowWidth, HUD_HEIGHT + LABEL_MARGIN))));
+    m_layer.clear(sf::Color::Transparent);
+    drawPanel(m_layer);
+    m_layer.display();
+    m_layerDirty = false;
+}
 
-    if (m_fontLoaded) {
-        if (m_fuelText) window.draw(*m_fuelText);
-        if (m_fuelValue) window.draw(*m_fuelValue);
-        if (m_tempText) window.draw(*m_tempText);
-        if (m_tempValue) window.draw(*m_tempValue);
-        if (m_warningEngineText) window.draw(*m_warningEngineText);
-        if (m_warningFuelText) window.draw(*m_warningFuelText);
-        if (m_warningCheckText) window.draw(*m_warningCheckText);
+void HUDPanel::render(sf::RenderWindow& window) {
+
+    if (m_layerReady && m_layerSprite) {
+        if (m_layerDirty) {
+            composeLayer();
+        }
+        window.draw(*m_layerSprite, premultipliedStates());
+    } else {
+        drawPanel(window);
     }
 
 
@@ -0,0 +1,125 @@
+#include "UI/ProfilerOverlay.h"
+#include "Profiler.h"
+#include "FontLoader.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+
+namespace {
+
+void appendQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    sf::Vector2f topRight(position.x + size.x, position.y);
+    sf::Vector2f bottomLeft(position.x, position.y + size.y);
+    sf::Vector2f bottomRight(position.x + size.x, position.y + size.y);
+
+    vertices.append(sf::Vertex{position, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{topRight, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomLeft, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomLeft, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{topRight, color, sf::Vector2f()});
+    vertices.append(sf::Vertex{bottomRight, color, sf::Vector2f()});
+}
+
+sf::Color frameColor(float milliseconds) {
+    if (milliseconds > 33.4f) {
+        return sf::Color(220, 60, 60);
+    }
+    if (milliseconds > 16.7f) {
+        return sf::Color(230, 190, 60);
+    }
+    return sf::Color(90, 210, 110);
+}
+
+}
+
+
+ProfilerOverlay::ProfilerOverlay()
+    : m_visible(false),
+      m_position(10.0f, 10.0f),
+      m_graph(sf::PrimitiveType::Triangles),
+      m_fontLoaded(false) {
+
+    if (auto fontOpt = FontLoader::load()) {
+        m_font = std::move(*fontOpt);
+        m_fontLoaded = true;
+        m_text.emplace(m_font, "", 12);
+        m_text->setFillColor(sf::Color::White);
+        m_text->setPosition(sf::Vector2f(m_position.x + 4.0f, m_position.y + GRAPH_HEIGHT + 6.0f));
+    }
+}
+
+void ProfilerOverlay::render(sf::RenderTarget& target) {
+    if (!m_visible) {
+        return;
+    }
+
+    buildGraph();
+    target.draw(m_graph);
+
+    if (m_fontLoaded) {
+        buildText();
+        target.draw(*m_text);
+    }
+}
+
+void ProfilerOverlay::buildGraph() {
+    const Profiler& profiler = Profiler::getInstance();
+    const std::size_t frames = profiler.getFrameCount();
+    const float barWidth = GRAPH_WIDTH / static_cast<float>(Profiler::FRAME_HISTORY);
+    const float textHeight = 16.0f * static_cast<float>(TOP_ZONE_COUNT + 2);
+
+    m_graph.clear();
+    appendQuad(m_graph, m_position, sf::Vector2f(GRAPH_WIDTH, GRAPH_HEIGHT + textHeight),
+               sf::Color(0, 0, 0, 180));
+
+
+    for (float budget : {16.7f, 33.3f}) {
+        float y = m_position.y + GRAPH_HEIGHT * (1.0f - budget / GRAPH_MAX_MS);
+        appendQuad(m_graph, sf::Vector2f(m_position.x, y), sf::Vector2f(GRAPH_WIDTH, 1.0f),
+                   sf::Color(255, 255, 255, 60));
+    }
+
+
+    for (std::size_t age = 0; age < frames; age++) {
+        float milliseconds = static_cast<float>(profiler.getFrame(age).durationMicros) / 1000.0f;
+        float height = GRAPH_HEIGHT * std::min(milliseconds / GRAPH_MAX_MS, 1.0f);
+        float x = m_position.x + GRAPH_WIDTH - barWidth * static_cast<float>(age + 1);
+        appendQuad(m_graph, sf::Vector2f(x, m_position.y + GRAPH_HEIGHT - height),
+                   sf::Vector2f(barWidth, height), frameColor(milliseconds));
+    }
+}
+
+void ProfilerOverlay::buildText() {
+    const Profiler& profiler = Profiler::getInstance();
+    const std::size_t frames = std::min(profiler.getFrameCount(), AVERAGE_FRAMES);
+
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2);
+
+    if (frames == 0) {
+        text << "No frames recorded";
+        m_text->setString(text.str());
+        return;
+    }
+
+    std::int64_t totalMicros = 0;
+    std::int64_t worstMicros = 0;
+    for (std::size_t age = 0; age < frames; age++) {
+        std::int64_t duration = profiler.getFrame(age).durationMicros;
+        totalMicros += duration;
+        worstMicros = std::max(worstMicros, duration);
+    }
+
+    text << "frame " << profiler.getFrame(0).durationMicros / 1000.0
+         << " ms  avg " << totalMicros / 1000.0 / static_cast<double>(frames)
+         << "  max " << worstMicros / 1000.0 << "\n";
+
+
+    for (const auto& zone : profiler.getTopZones(TOP_ZONE_COUNT, frames)) {
+        text << zone.name << "  " << zone.totalMicros / 1000.0 / static_cast<double>(frames)
+             << " ms  x" << zone.calls / frames << "\n";
+    }
+
+    m_text->setString(text.str());
+}
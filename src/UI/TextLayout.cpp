@@ -0,0 +1,227 @@
+#include "UI/TextLayout.h"
+#include "Profiler.h"
+#include <algorithm>
+
+
+namespace {
+
+bool isBreakingSpace(char32_t codePoint) {
+    return codePoint == U' ' || codePoint == U'\t' || codePoint == U'\r';
+}
+
+
+
+void decodeUtf8(const std::string& text, std::vector<char32_t>& codePoints) {
+    codePoints.clear();
+    codePoints.reserve(text.size());
+
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const auto lead = static_cast<unsigned char>(text[i]);
+        std::size_t length = 1;
+        char32_t codePoint = lead;
+
+        if (lead >= 0xF0 && lead < 0xF8) {
+            length = 4;
+            codePoint = lead & 0x07;
+        } else if (lead >= 0xE0) {
+            length = 3;
+            codePoint = lead & 0x0F;
+        } else if (lead >= 0xC0) {
+            length = 2;
+            codePoint = lead & 0x1F;
+        } else if (lead >= 0x80) {
+            codePoint = 0xFFFD;
+        }
+
+        if (i + length > text.size()) {
+            length = 1;
+            codePoint = 0xFFFD;
+        }
+        for (std::size_t k = 1; k < length; k++) {
+            const auto continuation = static_cast<unsigned char>(text[i + k]);
+            if ((continuation & 0xC0) != 0x80) {
+                length = 1;
+                codePoint = 0xFFFD;
+                break;
+            }
+            codePoint = (codePoint << 6) | (continuation & 0x3F);
+        }
+
+        codePoints.push_back(codePoint);
+        i += length;
+    }
+}
+
+}
+
+
+TextLayout::TextLayout()
+    : m_font(nullptr),
+      m_characterSize(0),
+      m_color(sf::Color::White),
+      m_visibleVertices(0),
+      m_size(0.0f, 0.0f),
+      m_cachedFont(nullptr) {
+}
+
+void TextLayout::build(const std::string& text,
+                       const sf::Font& font,
+                       unsigned int characterSize,
+                       float maxWidth,
+                       float lineSpacing,
+                       sf::Color color) {
+    ProfileZone zone("TextLayout::build");
+
+    if (m_cachedFont != &font) {
+        m_glyphCache.clear();
+        m_cachedFont = &font;
+    }
+
+    m_font = &font;
+    m_characterSize = characterSize;
+    m_color = color;
+    m_vertices.clear();
+    m_visibleVertices = 0;
+
+    decodeUtf8(text, m_codePoints);
+    const std::size_t count = m_codePoints.size();
+
+
+
+    m_vertexEnd.assign(count, 0);
+
+    const float lineHeight = font.getLineSpacing(characterSize) * lineSpacing;
+    const float spaceAdvance = getGlyph(U' ').advance;
+    float x = 0.0f;
+    float y = static_cast<float>(characterSize);
+    float widest = 0.0f;
+    bool lineHasContent = false;
+
+    std::size_t i = 0;
+    while (i < count) {
+        char32_t codePoint = m_codePoints[i];
+
+        if (codePoint == U'\n') {
+            x = 0.0f;
+            y += lineHeight;
+            lineHasContent = false;
+            m_vertexEnd[i] = m_vertices.size();
+            i++;
+            continue;
+        }
+
+        if (isBreakingSpace(codePoint)) {
+            m_vertexEnd[i] = m_vertices.size();
+            i++;
+            continue;
+        }
+
+
+        std::size_t wordEnd = i;
+        float wordWidth = 0.0f;
+        char32_t previous = 0;
+        while (wordEnd < count && m_codePoints[wordEnd] != U'\n' && !isBreakingSpace(m_codePoints[wordEnd])) {
+            char32_t current = m_codePoints[wordEnd];
+            if (previous != 0) {
+                wordWidth += font.getKerning(previous, current, characterSize);
+            }
+            wordWidth += getGlyph(current).advance;
+            previous = current;
+            wordEnd++;
+        }
+
+        if (lineHasContent && x + spaceAdvance + wordWidth > maxWidth) {
+            x = 0.0f;
+            y += lineHeight;
+            lineHasContent = false;
+        }
+        if (lineHasContent) {
+            x += spaceAdvance;
+        }
+
+        previous = 0;
+        for (std::size_t k = i; k < wordEnd; k++) {
+            char32_t current = m_codePoints[k];
+            if (previous != 0) {
+                x += font.getKerning(previous, current, characterSize);
+            }
+
+            const sf::Glyph& glyph = getGlyph(current);
+            appendGlyph(glyph, x, y);
+            x += glyph.advance;
+            m_vertexEnd[k] = m_vertices.size();
+            previous = current;
+        }
+
+        lineHasContent = true;
+        widest = std::max(widest, x);
+        i = wordEnd;
+    }
+
+    m_size = sf::Vector2f(widest, y - static_cast<float>(characterSize) + lineHeight);
+}
+
+void TextLayout::clear() {
+    m_font = nullptr;
+    m_vertices.clear();
+    m_vertexEnd.clear();
+    m_codePoints.clear();
+    m_visibleVertices = 0;
+    m_size = sf::Vector2f(0.0f, 0.0f);
+}
+
+void TextLayout::revealCharacters(std::size_t characterCount) {
+    if (characterCount == 0 || m_vertexEnd.empty()) {
+        m_visibleVertices = 0;
+        return;
+    }
+    m_visibleVertices = m_vertexEnd[std::min(characterCount, m_vertexEnd.size()) - 1];
+}
+
+void TextLayout::revealAll() {
+    m_visibleVertices = m_vertices.size();
+}
+
+void TextLayout::render(sf::RenderWindow& window, sf::Vector2f position) const {
+    if (!m_font || m_visibleVertices == 0) {
+        return;
+    }
+
+    sf::RenderStates states;
+    states.texture = &m_font->getTexture(m_characterSize);
+    states.transform.translate(position);
+    window.draw(m_vertices.data(), m_visibleVertices, sf::PrimitiveType::Triangles, states);
+}
+
+const sf::Glyph& TextLayout::getGlyph(char32_t codePoint) {
+    std::uint64_t key = (static_cast<std::uint64_t>(m_characterSize) << 32) | codePoint;
+    auto it = m_glyphCache.find(key);
+    if (it == m_glyphCache.end()) {
+        it = m_glyphCache.emplace(key, m_font->getGlyph(codePoint, m_characterSize, false)).first;
+    }
+    return it->second;
+}
+
+
+
+void TextLayout::appendGlyph(const sf::Glyph& glyph, float x, float y) {
+    const float padding = 1.0f;
+
+    const float left = glyph.bounds.position.x - padding;
+    const float top = glyph.bounds.position.y - padding;
+    const float right = glyph.bounds.position.x + glyph.bounds.size.x + padding;
+    const float bottom = glyph.bounds.position.y + glyph.bounds.size.y + padding;
+
+    const float u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
+    const float v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+    const float u2 = static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding;
+    const float v2 = static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding;
+
+    m_vertices.push_back({sf::Vector2f(x + left, y + top), m_color, sf::Vector2f(u1, v1)});
+    m_vertices.push_back({sf::Vector2f(x + right, y + top), m_color, sf::Vector2f(u2, v1)});
+    m_vertices.push_back({sf::Vector2f(x + left, y + bottom), m_color, sf::Vector2f(u1, v2)});
+    m_vertices.push_back({sf::Vector2f(x + left, y + bottom), m_color, sf::Vector2f(u1, v2)});
+    m_vertices.push_back({sf::Vector2f(x + right, y + top), m_color, sf::Vector2f(u2, v1)});
+    m_vertices.push_back({sf::Vector2f(x + right, y + bottom), m_color, sf::Vector2f(u2, v2)});
+}
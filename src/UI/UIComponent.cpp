@@ -1,5 +1,28 @@
 #include "UI/UIComponent.h"
 #include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+constexpr float CACHE_MARGIN = 4.f;
+
+
+sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+    sf::Vector2f min(std::min(a.position.x, b.position.x), std::min(a.position.y, b.position.y));
+    sf::Vector2f max(std::max(a.position.x + a.size.x, b.position.x + b.size.x),
+                     std::max(a.position.y + a.size.y, b.position.y + b.size.y));
+    return sf::FloatRect(min, max - min);
+}
+
+
+sf::RenderStates cacheBlendStates() {
+    sf::RenderStates states;
+    states.blendMode = sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+    return states;
+}
+
+}
 
 
 
@@ -11,7 +34,18 @@ UIComponent::UIComponent(const sf::Vector2f& position, const sf::Vector2f& size)
       m_visible(true),
       m_enabled(true),
       m_hovered(false),
-      m_focused(false) {
+      m_focused(false),
+      m_parent(nullptr),
+      m_dirty(true),
+      m_cacheEnabled(false) {
+}
+
+UIComponent::~UIComponent() {
+    for (auto& child : m_children) {
+        if (child && child->m_parent == this) {
+            child->m_parent = nullptr;
+        }
+    }
 }
 
 bool UIComponent::handleInput(const sf::Event& event) {
@@ -49,59 +83,198 @@ void UIComponent::update(float deltaTime) {
     updateChildren(deltaTime);
 }
 
+void UIComponent::draw(sf::RenderTarget& target) {
+    if (!m_visible) {
+        return;
+    }
+
+    if (!m_cacheEnabled) {
+        render(target);
+        m_dirty = false;
+        return;
+    }
+
+    if ((m_dirty || !m_cacheSprite) && !refreshCache()) {
+        render(target);
+        m_dirty = false;
+        return;
+    }
+
+    target.draw(*m_cacheSprite, cacheBlendStates());
+}
+
+void UIComponent::markDirty() {
+
+
+    for (UIComponent* component = this; component; component = component->m_parent) {
+        component->m_dirty = true;
+    }
+}
+
+void UIComponent::setCacheEnabled(bool enabled) {
+    if (m_cacheEnabled == enabled) {
+        return;
+    }
+
+    m_cacheEnabled = enabled;
+    if (!enabled) {
+        m_cacheSprite.reset();
+        m_cache.reset();
+    }
+    markDirty();
+}
+
+bool UIComponent::refreshCache() {
+    sf::FloatRect bounds = getSubtreeBounds();
+    sf::Vector2f origin(std::floor(bounds.position.x) - CACHE_MARGIN,
+                        std::floor(bounds.position.y) - CACHE_MARGIN);
+    sf::Vector2f extent(bounds.position.x + bounds.size.x + CACHE_MARGIN - origin.x,
+                        bounds.position.y + bounds.size.y + CACHE_MARGIN - origin.y);
+    sf::Vector2u textureSize(static_cast<unsigned int>(std::ceil(extent.x)),
+                             static_cast<unsigned int>(std::ceil(extent.y)));
+
+    if (textureSize.x == 0 || textureSize.y == 0) {
+        return false;
+    }
+
+    if (!m_cache) {
+        m_cache = std::make_unique<sf::RenderTexture>();
+    }
+
+    if (!m_cacheSprite || m_cache->getSize() != textureSize) {
+        if (!m_cache->resize(textureSize)) {
+            std::cerr << "[UI] Could not create cache texture for '" << m_id
+                      << "', drawing uncached" << std::endl;
+            m_cacheEnabled = false;
+            m_cacheSprite.reset();
+            m_cache.reset();
+            return false;
+        }
+        m_cacheSprite.emplace(m_cache->getTexture());
+    }
+
+
+    m_cache->setView(sf::View(sf::FloatRect(origin, sf::Vector2f(textureSize))));
+    m_cache->clear(sf::Color::Transparent);
+    render(*m_cache);
+    m_cache->display();
+
+    m_cacheSprite->setPosition(origin);
+    m_dirty = false;
+    return true;
+}
+
 void UIComponent::setPosition(const sf::Vector2f& position) {
+    if (m_position == position) {
+        return;
+    }
+
     m_position = position;
+    onLayoutChanged();
+    markDirty();
 }
 
 void UIComponent::setSize(const sf::Vector2f& size) {
+    if (m_size == size) {
+        return;
+    }
+
     m_size = size;
+    onLayoutChanged();
+    markDirty();
+}
+
+void UIComponent::setVisible(bool visible) {
+    if (m_visible == visible) {
+        return;
+    }
+
+    m_visible = visible;
+    markDirty();
+}
+
+void UIComponent::setEnabled(bool enabled) {
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    m_enabled = enabled;
+    markDirty();
 }
 
 sf::FloatRect UIComponent::getBounds() const {
     return sf::FloatRect(m_position, m_size);
 }
 
+sf::FloatRect UIComponent::getSubtreeBounds() const {
+    sf::FloatRect bounds = getVisualBounds();
+    for (const auto& child : m_children) {
+        if (child && child->isVisible()) {
+            bounds = unite(bounds, child->getSubtreeBounds());
+        }
+    }
+    return bounds;
+}
+
 void UIComponent::addChild(std::shared_ptr<UIComponent> child) {
     if (child) {
+        child->m_parent = this;
         m_children.push_back(child);
+        markDirty();
     }
 }
 
 void UIComponent::removeChild(std::shared_ptr<UIComponent> child) {
-    m_children.erase(
-        std::remove(m_children.begin(), m_children.end(), child),
-        m_children.end()
-    );
+    auto it = std::remove(m_children.begin(), m_children.end(), child);
+    if (it == m_children.end()) {
+        return;
+    }
+
+    m_children.erase(it, m_children.end());
+    if (child && child->m_parent == this) {
+        child->m_parent = nullptr;
+    }
+    markDirty();
 }
 
 void UIComponent::clearChildren() {
+    for (auto& child : m_children) {
+        if (child && child->m_parent == this) {
+            child->m_parent = nullptr;
+        }
+    }
     m_children.clear();
+    markDirty();
 }
 
 void UIComponent::onMouseEnter() {
     m_hovered = true;
+    markDirty();
 }
 
 void UIComponent::onMouseLeave() {
     m_hovered = false;
+    markDirty();
 }
 
 void UIComponent::onFocus() {
     m_focused = true;
+    markDirty();
 }
 
 void UIComponent::onBlur() {
     m_focused = false;
+    markDirty();
 }
 
 bool UIComponent::containsPoint(const sf::Vector2f& point) const {
     return getBounds().contains(point);
 }
 
-void UIComponent::renderChildren(sf::RenderWindow& window) {
+void UIComponent::renderChildren(sf::RenderTarget& target) {
     for (auto& child : m_children) {
         if (child && child->isVisible()) {
-            child->render(window);
+            child->draw(target);
         }
     }
 }
@@ -144,20 +317,36 @@ UIPanel::UIPanel(const sf::Vector2f& position, const sf::Vector2f& size,
     m_shape.setOutlineThickness(m_borderThickness);
 }
 
-void UIPanel::render(sf::RenderWindow& window) {
+void UIPanel::render(sf::RenderTarget& target) {
     if (!m_visible) {
         return;
     }
 
+    target.draw(m_shape);
+    renderChildren(target);
+}
+
+void UIPanel::setBackgroundColor(const sf::Color& color) {
+    m_backgroundColor = color;
+    m_shape.setFillColor(color);
+    markDirty();
+}
 
+void UIPanel::setBorderColor(const sf::Color& color) {
+    m_borderColor = color;
+    m_shape.setOutlineColor(color);
+    markDirty();
+}
+
+void UIPanel::setBorderThickness(float thickness) {
+    m_borderThickness = thickness;
+    m_shape.setOutlineThickness(thickness);
+    markDirty();
+}
+
+void UIPanel::onLayoutChanged() {
     m_shape.setPosition(m_position);
     m_shape.setSize(m_size);
-    m_shape.setFillColor(m_backgroundColor);
-    m_shape.setOutlineColor(m_borderColor);
-    m_shape.setOutlineThickness(m_borderThickness);
-
-    window.draw(m_shape);
-    renderChildren(window);
 }
 
 
@@ -177,22 +366,30 @@ UILabel::UILabel(const sf::Font& font, const std::string& text, const sf::Vector
     m_size = bounds.size;
 }
 
-void UILabel::render(sf::RenderWindow& window) {
+void UILabel::render(sf::RenderTarget& target) {
     if (!m_visible) {
         return;
     }
 
-    m_text.setPosition(m_position);
-    window.draw(m_text);
-    renderChildren(window);
+    target.draw(m_text);
+    renderChildren(target);
 }
 
 void UILabel::setText(const std::string& text) {
+    if (m_text.getString() == sf::String(text)) {
+        return;
+    }
+
     m_text.setString(text);
 
 
     sf::FloatRect bounds = m_text.getLocalBounds();
     m_size = bounds.size;
+    markDirty();
+}
+
+void UILabel::onLayoutChanged() {
+    m_text.setPosition(m_position);
 }
 
 
@@ -218,27 +415,17 @@ UIButton::UIButton(const sf::Font& font, const std::string& text, const sf::Vect
     m_shape.setOutlineThickness(2.f);
 
     m_text.setFillColor(m_textColor);
-
-
-    sf::FloatRect textBounds = m_text.getLocalBounds();
-    m_text.setPosition(sf::Vector2f(
-        position.x + (size.x - textBounds.size.x) / 2.f - textBounds.position.x,
-        position.y + (size.y - textBounds.size.y) / 2.f - textBounds.position.y
-    ));
+    centerText();
 }
 
-void UIButton::render(sf::RenderWindow& window) {
+void UIButton::render(sf::RenderTarget& target) {
     if (!m_visible) {
         return;
     }
 
-    m_shape.setPosition(m_position);
-    m_shape.setSize(m_size);
-    m_shape.setFillColor(m_currentColor);
-
-    window.draw(m_shape);
-    window.draw(m_text);
-    renderChildren(window);
+    target.draw(m_shape);
+    target.draw(m_text);
+    renderChildren(target);
 }
 
 bool UIButton::handleInput(const sf::Event& event) {
@@ -256,6 +443,7 @@ bool UIButton::handleInput(const sf::Event& event) {
                                  static_cast<float>(mousePressed->position.y));
             if (containsPoint(mousePos)) {
                 m_pressed = true;
+                refreshColor();
                 return true;
             }
         }
@@ -269,9 +457,11 @@ bool UIButton::handleInput(const sf::Event& event) {
                     m_callback();
                 }
                 m_pressed = false;
+                refreshColor();
                 return true;
             }
             m_pressed = false;
+            refreshColor();
         }
     }
 
@@ -282,21 +472,31 @@ void UIButton::update(float deltaTime) {
     UIComponent::update(deltaTime);
 
 
+    refreshColor();
+}
+
+sf::FloatRect UIButton::getVisualBounds() const {
+    return unite(m_shape.getGlobalBounds(), m_text.getGlobalBounds());
+}
+
+void UIButton::refreshColor() {
+    sf::Color color = m_normalColor;
     if (!m_enabled) {
-        m_currentColor = m_disabledColor;
+        color = m_disabledColor;
     } else if (m_pressed) {
-        m_currentColor = m_pressedColor;
+        color = m_pressedColor;
     } else if (m_hovered) {
-        m_currentColor = m_hoverColor;
-    } else {
-        m_currentColor = m_normalColor;
+        color = m_hoverColor;
     }
-}
-
-void UIButton::setText(const std::string& text) {
-    m_text.setString(text);
 
+    if (color != m_currentColor) {
+        m_currentColor = color;
+        m_shape.setFillColor(color);
+        markDirty();
+    }
+}
 
+void UIButton::centerText() {
     sf::FloatRect textBounds = m_text.getLocalBounds();
     m_text.setPosition(sf::Vector2f(
         m_position.x + (m_size.x - textBounds.size.x) / 2.f - textBounds.position.x,
@@ -304,13 +504,37 @@ void UIButton::setText(const std::string& text) {
     ));
 }
 
+void UIButton::setText(const std::string& text) {
+    if (m_text.getString() == sf::String(text)) {
+        return;
+    }
+
+    m_text.setString(text);
+    centerText();
+    markDirty();
+}
+
+void UIButton::setTextColor(const sf::Color& color) {
+    m_textColor = color;
+    m_text.setFillColor(color);
+    markDirty();
+}
+
+void UIButton::onLayoutChanged() {
+    m_shape.setPosition(m_position);
+    m_shape.setSize(m_size);
+    centerText();
+}
+
 void UIButton::onMouseEnter() {
     UIComponent::onMouseEnter();
+    refreshColor();
 }
 
 void UIButton::onMouseLeave() {
     UIComponent::onMouseLeave();
     m_pressed = false;
+    refreshColor();
 }
 
 
@@ -338,27 +562,63 @@ UIProgressBar::UIProgressBar(const sf::Vector2f& position, const sf::Vector2f& s
     m_bar.setFillColor(m_barColor);
 }
 
-void UIProgressBar::render(sf::RenderWindow& window) {
+void UIProgressBar::render(sf::RenderTarget& target) {
     if (!m_visible) {
         return;
     }
 
-    m_background.setPosition(m_position);
-    m_background.setSize(m_size);
+    target.draw(m_background);
+    target.draw(m_bar);
+    renderChildren(target);
+}
 
+void UIProgressBar::setValue(float value) {
+    float clamped = std::max(m_minValue, std::min(value, m_maxValue));
+    if (clamped == m_value) {
+        return;
+    }
+
+    m_value = clamped;
+    updateBarShape();
+    markDirty();
+}
+
+void UIProgressBar::setMinMax(float min, float max) {
+    m_minValue = min;
+    m_maxValue = max;
+    m_value = std::max(m_minValue, std::min(m_value, m_maxValue));
+    updateBarShape();
+    markDirty();
+}
+
+void UIProgressBar::setBarColor(const sf::Color& color) {
+    m_barColor = color;
+    m_bar.setFillColor(color);
+    markDirty();
+}
+
+void UIProgressBar::setBackgroundColor(const sf::Color& color) {
+    m_backgroundColor = color;
+    m_background.setFillColor(color);
+    markDirty();
+}
+
+void UIProgressBar::setBorderColor(const sf::Color& color) {
+    m_borderColor = color;
+    m_background.setOutlineColor(color);
+    markDirty();
+}
 
-    float progress = getProgress();
-    float barWidth = m_size.x * progress;
+void UIProgressBar::updateBarShape() {
+    float barWidth = m_maxValue > m_minValue ? m_size.x * getProgress() : 0.f;
     m_bar.setPosition(m_position);
     m_bar.setSize(sf::Vector2f(barWidth, m_size.y));
-
-    window.draw(m_background);
-    window.draw(m_bar);
-    renderChildren(window);
 }
 
-void UIProgressBar::setValue(float value) {
-    m_value = std::max(m_minValue, std::min(value, m_maxValue));
+void UIProgressBar::onLayoutChanged() {
+    m_background.setPosition(m_position);
+    m_background.setSize(m_size);
+    updateBarShape();
 }
 
 
@@ -386,18 +646,22 @@ UIImage::UIImage(const sf::Texture& texture, const sf::Vector2f& position,
     }
 }
 
-void UIImage::render(sf::RenderWindow& window) {
+void UIImage::render(sf::RenderTarget& target) {
     if (!m_visible) {
         return;
     }
 
+    target.draw(m_sprite);
+    renderChildren(target);
+}
+
+void UIImage::onLayoutChanged() {
     m_sprite.setPosition(m_position);
-    window.draw(m_sprite);
-    renderChildren(window);
 }
 
 void UIImage::setTexture(const sf::Texture& texture) {
     m_sprite.setTexture(texture);
+    markDirty();
 
 
     if (m_size.x == 0.f && m_size.y == 0.f) {
@@ -9,11 +9,11 @@ int main() {
     sf::RenderWindow window(sf::VideoMode({static_cast<unsigned int>(UI::SCREEN_WIDTH),
                                             static_cast<unsigned int>(UI::SCREEN_HEIGHT)}),
                            "KKURS");
-    window.setFramerateLimit(60);
 
     try {
 
         SceneManager sceneManager(window);
+        sceneManager.setFrameRateLimit(60);
         sceneManager.run();
     }
     catch (const std::exception& e) {
@@ -0,0 +1,467 @@
+#include "Notebook/NotebookEntry.h"
+#include "Notebook/StoryPackFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace StoryPackFormat;
+
+
+namespace {
+
+struct SourceEffect {
+    ChoiceEffectType type;
+    float amount = 0.0f;
+    std::string id;
+};
+
+struct SourceChoice {
+    std::string text;
+    std::vector<std::string> nextEntryIds;
+    std::vector<std::string> requiredPrinciples;
+    std::vector<std::string> requiredTraits;
+    std::vector<std::string> requiredStoryItems;
+    std::vector<SourceEffect> effects;
+    float probability = 1.0f;
+    float energyRequired = 0.0f;
+    float fuelRequired = 0.0f;
+    float moneyRequired = 0.0f;
+    std::uint32_t flags = 0;
+    std::string disabledReason;
+    std::string location;
+};
+
+struct SourceEntry {
+    std::string id;
+    EntryType type = EntryType::PRESENT;
+    std::string text;
+    bool hasText = false;
+    float printSpeed = 50.0f;
+    bool canSkip = true;
+    std::string date;
+    std::string location;
+    std::string mood;
+    std::string branchId;
+    std::vector<SourceChoice> choices;
+    std::string sourceLocation;
+};
+
+
+class CompileError : public std::runtime_error {
+public:
+    CompileError(const std::string& where, const std::string& what)
+        : std::runtime_error(where + ": " + what) {}
+};
+
+
+std::string trim(const std::string& str) {
+    size_t start = str.find_first_not_of(" \t\r");
+    if (start == std::string::npos) {
+        return "";
+    }
+    size_t end = str.find_last_not_of(" \t\r");
+    return str.substr(start, end - start + 1);
+}
+
+void splitKeyword(const std::string& line, std::string& keyword, std::string& rest) {
+    size_t space = line.find(' ');
+    if (space == std::string::npos) {
+        keyword = line;
+        rest.clear();
+    } else {
+        keyword = line.substr(0, space);
+        rest = trim(line.substr(space + 1));
+    }
+}
+
+std::vector<std::string> splitWords(const std::string& str) {
+    std::vector<std::string> words;
+    std::istringstream stream(str);
+    std::string word;
+    while (stream >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+float parseNumber(const std::string& value, const std::string& where) {
+    try {
+        size_t used = 0;
+        float result = std::stof(value, &used);
+        if (used != value.size()) {
+            throw CompileError(where, "invalid number '" + value + "'");
+        }
+        return result;
+    } catch (const std::invalid_argument&) {
+        throw CompileError(where, "invalid number '" + value + "'");
+    } catch (const std::out_of_range&) {
+        throw CompileError(where, "number out of range '" + value + "'");
+    }
+}
+
+bool parseBool(const std::string& value, const std::string& where) {
+    if (value == "true") return true;
+    if (value == "false") return false;
+    throw CompileError(where, "expected true or false, got '" + value + "'");
+}
+
+EntryType parseEntryType(const std::string& value, const std::string& where) {
+    if (value == "present") return EntryType::PRESENT;
+    if (value == "past") return EntryType::PAST;
+    if (value == "thought") return EntryType::THOUGHT;
+    throw CompileError(where, "unknown entry type '" + value + "'");
+}
+
+SourceEffect parseEffect(const std::string& value, const std::string& where) {
+    static const std::map<std::string, ChoiceEffectType> flagEffects = {
+        {"trait", ChoiceEffectType::TRAIT},
+        {"principle", ChoiceEffectType::PRINCIPLE},
+        {"item", ChoiceEffectType::STORY_ITEM}
+    };
+    static const std::map<std::string, ChoiceEffectType> resourceEffects = {
+        {"energy", ChoiceEffectType::ENERGY},
+        {"fuel", ChoiceEffectType::FUEL},
+        {"money", ChoiceEffectType::MONEY},
+        {"mood", ChoiceEffectType::MOOD},
+        {"reputation", ChoiceEffectType::REPUTATION},
+        {"vehicle", ChoiceEffectType::VEHICLE_CONDITION}
+    };
+
+    std::vector<std::string> words = splitWords(value);
+    if (words.size() != 2) {
+        throw CompileError(where, "effect expects '<kind> <value>'");
+    }
+
+    SourceEffect effect;
+    auto flagIt = flagEffects.find(words[0]);
+    if (flagIt != flagEffects.end()) {
+        effect.type = flagIt->second;
+        effect.id = words[1];
+        return effect;
+    }
+
+    auto resourceIt = resourceEffects.find(words[0]);
+    if (resourceIt != resourceEffects.end()) {
+        effect.type = resourceIt->second;
+        effect.amount = parseNumber(words[1], where);
+        return effect;
+    }
+
+    throw CompileError(where, "unknown effect '" + words[0] + "'");
+}
+
+void parseChoiceLine(SourceChoice& choice, const std::string& keyword, const std::string& rest,
+                     const std::string& where) {
+    if (keyword == "next") {
+        choice.nextEntryIds = splitWords(rest);
+    } else if (keyword == "requires") {
+        std::vector<std::string> words = splitWords(rest);
+        if (words.size() != 2) {
+            throw CompileError(where, "requires expects '<principle|trait|item> <id>'");
+        }
+        if (words[0] == "principle") {
+            choice.requiredPrinciples.push_back(words[1]);
+        } else if (words[0] == "trait") {
+            choice.requiredTraits.push_back(words[1]);
+        } else if (words[0] == "item") {
+            choice.requiredStoryItems.push_back(words[1]);
+        } else {
+            throw CompileError(where, "unknown requirement '" + words[0] + "'");
+        }
+    } else if (keyword == "effect") {
+        choice.effects.push_back(parseEffect(rest, where));
+    } else if (keyword == "hidden") {
+        choice.flags |= CHOICE_HIDDEN;
+    } else if (keyword == "quit") {
+        choice.flags |= CHOICE_QUITS_GAME;
+    } else if (keyword == "disabled") {
+        choice.flags |= CHOICE_DISABLED;
+        choice.disabledReason = rest;
+    } else if (keyword == "probability") {
+        choice.probability = parseNumber(rest, where);
+    } else if (keyword == "energy_required") {
+        choice.energyRequired = parseNumber(rest, where);
+    } else if (keyword == "fuel_required") {
+        choice.fuelRequired = parseNumber(rest, where);
+    } else if (keyword == "money_required") {
+        choice.moneyRequired = parseNumber(rest, where);
+    } else {
+        throw CompileError(where, "unknown choice property '" + keyword + "'");
+    }
+}
+
+void parseEntryLine(SourceEntry& entry, const std::string& keyword, const std::string& rest,
+                    const std::string& where) {
+    if (keyword == "type") {
+        entry.type = parseEntryType(rest, where);
+    } else if (keyword == "date") {
+        entry.date = rest;
+    } else if (keyword == "location") {
+        entry.location = rest;
+    } else if (keyword == "mood") {
+        entry.mood = rest;
+    } else if (keyword == "branch") {
+        entry.branchId = rest;
+    } else if (keyword == "speed") {
+        entry.printSpeed = parseNumber(rest, where);
+    } else if (keyword == "skip") {
+        entry.canSkip = parseBool(rest, where);
+    } else {
+        throw CompileError(where, "unknown entry property '" + keyword + "'");
+    }
+}
+
+void parseSourceFile(const std::string& path, std::vector<SourceEntry>& entries) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw CompileError(path, "cannot open file");
+    }
+
+    SourceEntry* entry = nullptr;
+    SourceChoice* choice = nullptr;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        std::string where = path + ":" + std::to_string(lineNumber);
+
+
+        if (!line.empty() && line[0] == '|') {
+            if (!entry || choice) {
+                throw CompileError(where, "text line outside of an entry body");
+            }
+            std::string textLine = line.size() > 1 && line[1] == ' ' ? line.substr(2) : line.substr(1);
+            if (entry->hasText) {
+                entry->text += '\n';
+            }
+            entry->text += textLine;
+            entry->hasText = true;
+            continue;
+        }
+
+        std::string content = trim(line);
+        if (content.empty() || content[0] == '#') {
+            continue;
+        }
+
+        std::string keyword;
+        std::string rest;
+        splitKeyword(content, keyword, rest);
+
+        if (keyword == "entry") {
+            if (rest.empty() || rest.find(' ') != std::string::npos) {
+                throw CompileError(where, "entry expects a single id");
+            }
+            entries.emplace_back();
+            entry = &entries.back();
+            entry->id = rest;
+            entry->sourceLocation = where;
+            choice = nullptr;
+        } else if (!entry) {
+            throw CompileError(where, "'" + keyword + "' before the first entry");
+        } else if (keyword == "choice") {
+            entry->choices.emplace_back();
+            choice = &entry->choices.back();
+            choice->text = rest;
+            choice->location = where;
+        } else if (choice) {
+            parseChoiceLine(*choice, keyword, rest, where);
+        } else {
+            parseEntryLine(*entry, keyword, rest, where);
+        }
+    }
+}
+
+void validate(const std::vector<SourceEntry>& entries) {
+    std::set<std::string> ids;
+    for (const auto& entry : entries) {
+        if (!ids.insert(entry.id).second) {
+            throw CompileError(entry.sourceLocation, "duplicate entry id '" + entry.id + "'");
+        }
+    }
+
+    for (const auto& entry : entries) {
+        for (const auto& choice : entry.choices) {
+            for (const auto& nextId : choice.nextEntryIds) {
+                if (ids.count(nextId) == 0) {
+                    throw CompileError(choice.location, "unknown next entry '" + nextId + "'");
+                }
+            }
+        }
+    }
+}
+
+
+
+class PackWriter {
+public:
+    StringRef addString(const std::string& str) {
+        if (str.empty()) {
+            return StringRef{0, 0};
+        }
+        auto it = m_stringOffsets.find(str);
+        if (it != m_stringOffsets.end()) {
+            return StringRef{it->second, static_cast<std::uint32_t>(str.size())};
+        }
+        std::uint32_t offset = static_cast<std::uint32_t>(m_strings.size());
+        m_strings.insert(m_strings.end(), str.begin(), str.end());
+        m_stringOffsets[str] = offset;
+        return StringRef{offset, static_cast<std::uint32_t>(str.size())};
+    }
+
+    Range addIds(const std::vector<std::string>& ids) {
+        Range range{static_cast<std::uint32_t>(m_ids.size()), static_cast<std::uint32_t>(ids.size())};
+        for (const auto& id : ids) {
+            m_ids.push_back(addString(id));
+        }
+        return range;
+    }
+
+    void addEntry(const SourceEntry& source) {
+        EntryRecord record{};
+        record.id = addString(source.id);
+        record.type = static_cast<std::uint32_t>(source.type);
+        record.printSpeed = source.printSpeed;
+        record.canSkip = source.canSkip ? 1u : 0u;
+        record.text = addString(source.text);
+        record.date = addString(source.date);
+        record.location = addString(source.location);
+        record.mood = addString(source.mood);
+        record.branchId = addString(source.branchId);
+        record.choices = Range{static_cast<std::uint32_t>(m_choices.size()),
+                               static_cast<std::uint32_t>(source.choices.size())};
+
+        for (const auto& choice : source.choices) {
+            ChoiceRecord choiceRecord{};
+            choiceRecord.text = addString(choice.text);
+            choiceRecord.probability = choice.probability;
+            choiceRecord.energyRequired = choice.energyRequired;
+            choiceRecord.fuelRequired = choice.fuelRequired;
+            choiceRecord.moneyRequired = choice.moneyRequired;
+            choiceRecord.flags = choice.flags;
+            choiceRecord.disabledReason = addString(choice.disabledReason);
+            choiceRecord.nextEntryIds = addIds(choice.nextEntryIds);
+            choiceRecord.requiredPrinciples = addIds(choice.requiredPrinciples);
+            choiceRecord.requiredTraits = addIds(choice.requiredTraits);
+            choiceRecord.requiredStoryItems = addIds(choice.requiredStoryItems);
+            choiceRecord.effects = Range{static_cast<std::uint32_t>(m_effects.size()),
+                                         static_cast<std::uint32_t>(choice.effects.size())};
+
+            for (const auto& effect : choice.effects) {
+                EffectRecord effectRecord{};
+                effectRecord.type = static_cast<std::uint32_t>(effect.type);
+                effectRecord.amount = effect.amount;
+                effectRecord.id = addString(effect.id);
+                m_effects.push_back(effectRecord);
+            }
+
+            m_choices.push_back(choiceRecord);
+        }
+
+        m_entries.push_back(record);
+    }
+
+    bool write(const std::string& path) const {
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+
+        std::uint32_t offset = static_cast<std::uint32_t>(sizeof(Header));
+        header.entries = Range{offset, static_cast<std::uint32_t>(m_entries.size())};
+        offset += static_cast<std::uint32_t>(m_entries.size() * sizeof(EntryRecord));
+        header.choices = Range{offset, static_cast<std::uint32_t>(m_choices.size())};
+        offset += static_cast<std::uint32_t>(m_choices.size() * sizeof(ChoiceRecord));
+        header.ids = Range{offset, static_cast<std::uint32_t>(m_ids.size())};
+        offset += static_cast<std::uint32_t>(m_ids.size() * sizeof(StringRef));
+        header.effects = Range{offset, static_cast<std::uint32_t>(m_effects.size())};
+        offset += static_cast<std::uint32_t>(m_effects.size() * sizeof(EffectRecord));
+        header.strings = Range{offset, static_cast<std::uint32_t>(m_strings.size())};
+        offset += static_cast<std::uint32_t>(m_strings.size());
+        header.fileSize = offset;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(m_entries.data()), m_entries.size() * sizeof(EntryRecord));
+        file.write(reinterpret_cast<const char*>(m_choices.data()), m_choices.size() * sizeof(ChoiceRecord));
+        file.write(reinterpret_cast<const char*>(m_ids.data()), m_ids.size() * sizeof(StringRef));
+        file.write(reinterpret_cast<const char*>(m_effects.data()), m_effects.size() * sizeof(EffectRecord));
+        file.write(m_strings.data(), static_cast<std::streamsize>(m_strings.size()));
+        return file.good();
+    }
+
+    size_t getStringBytes() const { return m_strings.size(); }
+
+private:
+    std::vector<EntryRecord> m_entries;
+    std::vector<ChoiceRecord> m_choices;
+    std::vector<StringRef> m_ids;
+    std::vector<EffectRecord> m_effects;
+    std::vector<char> m_strings;
+    std::map<std::string, std::uint32_t> m_stringOffsets;
+};
+
+}
+
+
+int main(int argc, char** argv) {
+    std::string outputPath;
+    std::vector<std::string> inputPaths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            inputPaths.push_back(arg);
+        }
+    }
+
+    if (outputPath.empty() || inputPaths.empty()) {
+        std::cerr << "Usage: story_compiler -o <story.pack> <file.story>..." << std::endl;
+        return 2;
+    }
+
+    std::vector<SourceEntry> entries;
+    try {
+        for (const auto& path : inputPaths) {
+            parseSourceFile(path, entries);
+        }
+        validate(entries);
+    } catch (const CompileError& e) {
+        std::cerr << "story_compiler: " << e.what() << std::endl;
+        return 1;
+    }
+
+
+    std::sort(entries.begin(), entries.end(),
+        [](const SourceEntry& a, const SourceEntry& b) { return a.id < b.id; });
+
+    PackWriter writer;
+    for (const auto& entry : entries) {
+        writer.addEntry(entry);
+    }
+
+    if (!writer.write(outputPath)) {
+        std::cerr << "story_compiler: cannot write " << outputPath << std::endl;
+        return 1;
+    }
+
+    std::cout << "story_compiler: wrote " << entries.size() << " entries ("
+              << writer.getStringBytes() << " bytes of text) to " << outputPath << std::endl;
+    return 0;
+}